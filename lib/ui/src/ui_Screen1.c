@@ -21,6 +21,7 @@ lv_obj_t * ui_Bar1 = NULL;
 lv_obj_t * ui_Panel2 = NULL;
 lv_obj_t * ui_Image2 = NULL;
 lv_obj_t * ui_PLAYING_DEVICE = NULL;
+lv_obj_t * ui_VOLUME = NULL;
 lv_obj_t * ui_Image3 = NULL;
 lv_obj_t * ui_shuffleblack = NULL;
 lv_obj_t * ui_shufflegreen = NULL;
@@ -144,6 +145,14 @@ void ui_Screen1_screen_init(void)
     lv_obj_set_align(ui_PLAYING_DEVICE, LV_ALIGN_CENTER);
     lv_label_set_text(ui_PLAYING_DEVICE, "PLAYING ON ");
 
+    ui_VOLUME = lv_label_create(ui_Screen1);
+    lv_obj_set_width(ui_VOLUME, LV_SIZE_CONTENT);   /// 1
+    lv_obj_set_height(ui_VOLUME, LV_SIZE_CONTENT);    /// 1
+    lv_obj_set_x(ui_VOLUME, 98);
+    lv_obj_set_y(ui_VOLUME, 142);
+    lv_obj_set_align(ui_VOLUME, LV_ALIGN_CENTER);
+    lv_label_set_text(ui_VOLUME, "--%");
+
     ui_Image3 = lv_image_create(ui_Screen1);
     lv_image_set_src(ui_Image3, &ui_img_1011443021);
     lv_obj_set_width(ui_Image3, LV_SIZE_CONTENT);   /// 150
@@ -222,6 +231,7 @@ void ui_Screen1_screen_destroy(void)
     ui_Panel2 = NULL;
     ui_Image2 = NULL;
     ui_PLAYING_DEVICE = NULL;
+    ui_VOLUME = NULL;
     ui_Image3 = NULL;
     uic_shuffleblack = NULL;
     ui_shuffleblack = NULL;
@@ -25,6 +25,7 @@ extern lv_obj_t * ui_Bar1;
 extern lv_obj_t * ui_Panel2;
 extern lv_obj_t * ui_Image2;
 extern lv_obj_t * ui_PLAYING_DEVICE;
+extern lv_obj_t * ui_VOLUME;
 extern lv_obj_t * ui_Image3;
 extern lv_obj_t * ui_shuffleblack;
 extern lv_obj_t * ui_shufflegreen;
@@ -10,718 +10,366 @@
 #endif
 
 // IMAGE DATA: assets/Adobe Express - file.png
+// Pre-swapped for LV_COLOR_FORMAT_RGB565_SWAPPED by scripts/preswap_images.py
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_1011443021_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8B,0x16,0xAC,0x16,0xCC,0x1E,
-    0xCB,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCB,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x16,0xCC,0x1E,0xCC,0x16,0xAA,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x11,0x44,0x11,0xA4,
+    0x12,0x04,0x12,0xC6,0x13,0xA7,0x14,0x68,0x15,0x29,0x15,0xC9,0x16,0x2B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x2B,0x15,0xC9,0x15,0x09,0x14,0x68,0x13,0xC7,0x12,0xC6,0x12,0x04,0x11,0xA4,0x11,0x44,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x10,0xE3,0x11,0x03,0x12,0x04,0x13,0x67,0x14,0xA9,0x15,0x6A,0x15,0xC9,0x16,0x2A,0x16,0x8B,0x16,0x8B,0x16,0xAC,0x16,0xAC,0x16,0xAC,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xCC,0x16,0xAC,0x16,0x8B,0x16,0xAC,0x16,0x8B,0x16,0x8A,0x16,0x2B,0x15,0xCA,0x15,0x6A,0x14,0xA9,0x13,0x67,0x12,0x04,0x11,0x03,0x10,0xE3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x10,0xE3,0x11,0x23,0x12,0x25,0x13,0x06,0x14,0x88,0x15,0xEA,0x16,0x8B,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xAC,0x16,0x8B,0x15,0xCA,0x14,0x88,0x13,0x06,0x12,0x25,0x11,0x24,0x10,0xE3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x10,0xC3,0x10,0xE3,0x11,0xA4,0x14,0x48,0x16,0x2A,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,0x16,0x2A,0x14,0x47,0x11,0xA4,0x10,0xE3,0x10,0xC3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0x25,0x14,0x08,0x15,0xAA,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x15,0xAA,0x14,0x08,0x12,0x25,0x10,0xC3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0x44,0x12,0xC5,0x15,0x8A,0x16,0x8B,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xAC,0x16,0x8B,0x15,0x8A,0x12,0xC6,0x11,0x44,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x11,0x64,0x14,0x28,0x15,0xAA,0x16,0x8B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0x8B,0x15,0xC9,0x14,0x27,0x11,0x84,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xE3,0x11,0xE5,0x14,0x07,0x16,0x4A,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0x4B,0x14,0x08,0x12,0x04,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x10,0xC3,0x11,0x43,0x14,0x88,0x16,0x4A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x6B,0x14,0x88,0x11,0x44,0x10,0xC3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x64,0x13,0xC7,0x16,0x2B,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x4B,0x13,0xC7,0x11,0x64,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x03,
+    0x12,0xA5,0x16,0x0B,0x16,0x8C,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8C,0x15,0xEB,0x12,0xC6,0x11,0x03,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0x05,0x15,0x09,0x16,0x6B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x6B,0x15,0x09,0x12,0x05,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0x44,0x13,0x26,0x16,0x2B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x4B,0x13,0x47,0x11,0x44,0x10,0xC3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0x64,0x15,0x4A,0x16,0xAC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x15,0x69,0x11,0x64,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0x26,0x16,0x2A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x2A,0x13,0x26,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x14,0x68,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x16,0xCC,0x16,0xAC,0x14,0x88,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0xE4,0x15,0x2A,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x15,0x2A,0x11,0xE5,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0x25,0x15,0xCA,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0xCA,0x12,0x25,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0xC6,0x16,0x4A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x4A,0x12,0xC6,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x13,0x66,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x6B,0x13,0x66,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x13,0x87,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,0x13,0x87,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x13,0xE8,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x13,0xE8,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x03,0x13,0xC7,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x13,0xC7,0x11,0x03,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0xA7,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x13,0xA7,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x13,0x67,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,0x13,0x67,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x12,0x65,0x16,0x8A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x6A,0x12,0x85,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0x65,0x16,0x4B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x4A,
+    0x12,0x85,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x84,0x15,0xCA,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0xAA,0x11,0x84,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x15,0x8A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0x8A,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x14,0x48,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0x48,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0x26,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xAC,0x13,0x26,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0xA4,0x15,0xEB,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCB,0x16,0x0B,0x11,0xA4,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x15,0x4A,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0x4A,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0x87,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x13,0x87,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0xC4,0x16,0x0B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x0B,0x11,0xC4,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x15,0x8A,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x15,0x8A,0x11,0x03,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0xE6,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x12,0xE6,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x16,0x0B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x0B,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x14,0x08,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0x08,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x84,0x16,0x2B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x15,0xEA,0x15,0x08,0x14,0xA8,0x0C,0x47,0x0C,0x07,0x0B,0xE7,0x0B,0xE6,0x0B,0x45,0x0A,0x84,0x01,0xC3,0x01,0x82,0x01,0x62,0x01,0x42,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x02,0x01,0x01,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x42,0x01,0x62,0x01,0xA2,0x01,0xE3,0x0A,0x84,0x0B,0x66,0x0B,0xE6,0x0C,0x07,0x0C,0x07,0x0C,0x67,0x14,0xA8,0x14,0xE8,0x15,0xCA,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x2B,0x11,0x84,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x14,0x48,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x16,0x6B,0x16,0x2B,0x16,0x2B,0x15,0x08,0x0A,0xA4,0x01,0xC3,0x01,0x01,0x00,0xC1,0x00,0x81,0x00,0x60,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,
+    0x00,0x80,0x00,0xC1,0x01,0x01,0x01,0xA2,0x0A,0x64,0x0B,0xE6,0x16,0x0A,0x16,0x2B,0x16,0x4B,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCB,0x14,0x48,0x10,0xE3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x12,0x05,0x16,0x6B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x8B,0x16,0x6B,0x15,0xEA,0x0C,0x27,0x0B,0x86,0x0A,0xE5,0x01,0x62,0x00,0xA1,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0xE1,0x01,0xE3,0x0B,0x25,0x0B,0x86,0x0C,0x47,0x15,0xEA,0x16,0x6B,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x12,0x05,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x14,0x28,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x16,0x8B,0x16,0x4B,0x15,0xCA,0x15,0x49,0x0A,0x64,0x00,0xC1,0x00,0x20,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x01,0xE3,0x14,0xC8,0x15,0xAA,0x15,0xEA,0x16,0x6B,
+    0x16,0x8B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCB,0x14,0x28,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x44,0x16,0x2B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x0C,0x88,0x02,0x43,0x01,0x22,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x01,0xA2,0x0A,0x84,0x15,0x69,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x16,0x2B,0x11,0x44,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x14,0x28,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x6B,0x0C,0x47,0x00,0xE1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xA1,0x02,0x03,0x0C,0x27,0x15,0x29,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0x27,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x64,0x16,0x2A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x8B,0x0A,0x84,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xEC,0x26,0xEC,0x16,0xAB,0x16,0xAC,0x1E,0xCC,0x16,0xCC,0x16,0xCB,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0xCC,0x1E,0xCB,0x16,0xEC,0x16,0xEC,0x26,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x01,0x01,0x0A,0xE5,0x16,0x2B,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x2A,0x11,0x64,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0xE6,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x0B,0x25,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0xA2,0x0B,0x86,0x15,0x29,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x12,0xE6,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x15,0x2A,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x15,0xEA,0x00,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x22,0x15,0x08,0x16,0x0A,0x16,0x8B,0x1E,0xAB,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x15,0x4A,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0xE5,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x0B,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x05,0xCD,0x26,0x8B,0x16,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCC,0x1E,0xAC,0x16,0xAC,0x1E,0x8C,0x16,0xCD,0x26,0x4A,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xAA,0x06,0x0A,0x1F,0xAC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCB,0x1E,0xAB,0x16,0x0A,0x1F,0xAA,0x06,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x0A,0x24,0x15,0xAA,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x11,0xE5,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x14,0x28,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x01,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0xE3,0x14,0x88,0x16,0x4B,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0x28,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x15,0xAA,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x06,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAA,0x06,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x01,0x0C,0x07,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0xAA,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0xE4,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCC,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCB,0x16,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x26,0x8B,0x16,0xCC,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCB,0x1E,0x0C,0x17,0xCD,0x26,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x62,0x0C,0x07,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x11,0xC4,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0xE8,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x02,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x15,0x09,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x13,0xE8,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x16,0x0B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x0C,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE1,0x01,0xC2,0x02,0x84,0x0A,0xE5,0x0B,0x25,0x0B,0x46,0x0B,0x25,0x0B,0x05,0x0A,0xC4,0x02,0x23,0x01,0x62,0x00,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0xA2,0x15,0xAA,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x0B,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x12,0x45,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x2A,0x01,0x22,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x62,0x02,0x03,0x0A,0x44,0x0A,0x64,0x0A,0xE5,0x0C,0x88,0x15,0x89,0x15,0xCA,0x16,0x0A,0x16,0x4B,0x16,0x4B,0x16,0x4B,0x16,0x6B,0x16,0x6B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x6B,0x16,0x6B,0x16,0x6B,0x16,0x4B,0x16,0x4B,0x16,0x2B,0x16,0x0A,0x15,0xCA,0x15,0x69,0x0C,0xA8,0x0A,0xC4,0x0A,0x64,0x0A,0x44,0x02,0x03,0x01,0xA3,0x00,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x0B,0xC6,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x12,0x25,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x13,0x66,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x14,0xA8,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x00,0xA1,0x0A,0xE5,0x14,0xA8,0x15,0x49,0x15,0x89,0x16,0x2B,0x16,0x6B,0x16,0x8B,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x16,0x8B,0x16,0x8B,0x16,0x4B,0x15,0xCA,0x15,0x69,0x15,0x29,0x14,0x88,0x01,0xE3,0x00,0x81,0x00,0x80,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x0B,0xA6,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x13,0x66,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x14,0x88,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x0C,0x47,0x00,0xA1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xE1,0x0A,0x84,0x0B,0x05,0x14,0xA8,0x16,0x2B,0x16,0x8B,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x16,0x8B,0x16,0x2B,0x15,0x29,0x0B,0x25,0x0A,0xC5,0x02,0x03,0x00,0x60,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x15,0x89,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x14,0x88,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x11,0x03,0x15,0xAA,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,
+    0x16,0x4B,0x0A,0x84,0x00,0x81,0x00,0x60,0x00,0x60,0x00,0x81,0x00,0xA1,0x0B,0x25,0x16,0x2A,0x1E,0xAB,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x16,0x8B,0x15,0xEA,0x02,0x84,0x00,0xA1,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0B,0x66,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0xAA,0x11,0x03,0x10,0xA3,0x10,0xA3,0x11,0x84,0x16,0x6B,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x16,0x6B,0x16,0x0A,0x15,0xEA,0x16,0x4B,0x16,0x8B,0x1E,0xAB,0x1E,0xAC,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x16,0x8B,0x16,0x0A,0x14,0xC8,0x0B,0xC6,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x82,0x1E,0xAB,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x11,0x84,0x10,0xA3,0x10,0xA3,0x13,0x26,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x16,0xAB,0x16,0x6B,0x15,0xCA,0x0A,0xC4,0x01,0xE3,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x13,0x26,0x10,0xA3,0x10,0xA3,0x14,0xA9,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x16,0x6B,0x15,0x69,0x0C,0x47,0x00,0xA1,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0xA9,0x10,0xA3,0x10,0xC3,0x15,0xCA,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x6B,0x14,0xA8,0x0A,0xA4,0x00,0xA1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,
+    0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0xEA,0x10,0xC3,0x11,0x64,0x16,0x2B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xAC,0x16,0x8B,0x0B,0x86,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x64,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x2B,0x11,0x64,0x11,0xE4,0x16,0x4B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x16,0x2B,0x0C,0x47,0x01,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x14,0xC8,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x4A,0x11,0xE4,
+    0x12,0x65,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x4B,0x15,0xCA,0x15,0x49,0x14,0xE8,0x14,0xC8,0x14,0xC8,0x14,0xC8,0x14,0xC8,
+    0x14,0xC8,0x14,0xE8,0x15,0x49,0x15,0xCA,0x16,0x6B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x6B,0x14,0x88,0x01,0x82,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
+    0x01,0xE3,0x16,0x8B,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x12,0x65,0x12,0xE6,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x4B,0x16,0x2B,0x16,0x2B,0x16,0x0A,0x0B,0xE6,0x02,0x03,0x01,0xE3,0x01,0xA3,0x01,0x82,0x01,0x82,0x01,0x82,0x01,0x42,0x00,0xE1,0x00,0x80,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x81,0x00,0xE1,0x01,0x42,0x01,0x82,0x01,0x82,0x01,0x82,0x01,0xC3,0x01,0xE3,0x02,0x03,0x0B,0xE6,0x16,0x0A,0x16,0x2B,0x16,0x2B,0x16,0x4B,0x16,0x8B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x2B,0x0C,0x47,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x02,0x03,0x16,0x2A,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x12,0xE6,0x13,0xA7,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x6B,0x16,0x6B,0x15,0xAA,0x0C,0x47,0x0C,0x07,0x0B,0x86,0x01,0x01,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x80,0x0A,0xC4,0x0B,0xE7,0x0C,0x27,0x14,0x67,
+    0x16,0x2B,0x16,0x6B,0x16,0x8B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x2A,0x0B,0x05,0x00,0xC1,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xC1,0x0A,0xE5,0x16,0x4B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x16,0xAC,0x13,0xA7,0x14,0x68,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x16,0x8B,0x16,0x6B,0x15,0x49,0x00,0xC1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x01,0x15,0x69,0x16,0x8B,0x16,0x8B,0x1E,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x16,0x4B,0x15,0x49,0x15,0x69,0x16,0x4B,0x1E,0xAB,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0x48,0x14,0xE8,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x2B,0x0A,0xE5,0x0A,0x24,0x00,0xA1,0x00,0x40,0x00,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xE1,0x0A,0x44,0x0A,0xA4,0x15,0x89,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0xE9,0x15,0x8A,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x2B,0x14,0xA8,0x00,0xE1,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xA1,0x0B,0x25,0x14,0xC8,0x15,0xEA,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x15,0x6A,0x15,0xEA,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x4B,0x01,0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0xC3,0x0C,0x87,0x16,0x4B,0x16,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0xEA,0x16,0x4A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x02,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0B,0x45,0x0C,0x67,
+    0x16,0x6B,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x2B,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0B,0x45,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x0B,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x0A,0x44,0x14,0xC8,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x01,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xE0,0x07,0x8B,0x16,0xCC,0x1E,0xCB,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0x8B,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x6C,0x06,0xEB,0x16,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xEC,0x16,0x6C,0x06,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x1E,0xCC,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xCC,0x16,
-    0xCB,0x1E,0xCC,0x1E,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x2E,0xAC,0x16,0xCC,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCC,0x1E,0xAB,0x16,0xAA,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x07,0xEC,0x16,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0xEA,0x07,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x05,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0x8C,0x1E,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x05,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x04,0xCB,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x05,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAC,0x1E,0xF0,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xAA,0x2E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xAA,0x2E,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x6C,0x06,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAC,0x16,0x6C,0x06,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0x6C,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAA,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x6C,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x16,0xCB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x26,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xEC,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x26,0xAB,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xC9,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x05,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,
-    0xCB,0x1E,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xCB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCB,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x05,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x07,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xEC,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x07,0xCB,0x1E,0xAC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCB,0x1E,0xEA,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xAA,0x16,0xAC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0x4B,0x17,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x26,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCD,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xCC,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xEA,0x15,0x08,0x15,0xA8,0x14,0x47,0x0C,0x07,0x0C,0xE7,0x0B,0xE6,0x0B,0x45,0x0B,0x84,0x0A,0xC3,0x01,0x82,0x01,0x62,0x01,0x42,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x02,0x01,0x01,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x42,0x01,0x62,0x01,0xA2,0x01,0xE3,0x01,0x84,0x0A,0x66,0x0B,0xE6,0x0B,0x07,0x0C,0x07,0x0C,0x67,0x0C,0xA8,0x14,0xE8,0x14,0xCA,0x15,0xAB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x25,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x6B,0x16,0x2B,0x16,0x2B,0x16,0x08,0x15,0xA4,0x0A,0xC3,0x01,0x01,0x01,0xC1,0x00,0x81,0x00,0x60,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,
-    0x80,0x00,0xC1,0x00,0x01,0x01,0xA2,0x01,0x64,0x0A,0xE6,0x0B,0x0A,0x16,0x2B,0x16,0x4B,0x16,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xEC,0x25,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x8B,0x16,0x6B,0x16,0xEA,0x15,0x27,0x0C,0x86,0x0B,0xE5,0x0A,0x62,0x01,0xA1,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0xE1,0x00,0xE3,0x01,0x25,0x0B,0x86,0x0B,0x47,0x0C,0xEA,0x15,0x6B,0x16,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0x8B,0x16,0x4B,0x16,0xCA,0x15,0x49,0x15,0x64,0x0A,0xC1,0x00,0x20,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x00,0xE3,0x01,0xC8,0x14,0xAA,0x15,0xEA,0x15,0x6B,0x16,
-    0x8B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x88,0x0C,0x43,0x02,0x22,0x01,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x00,0xA2,0x01,0x84,0x0A,0x69,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xAB,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x6B,0x16,0x47,0x0C,0xE1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xA1,0x00,0x03,0x02,0x27,0x0C,0x29,0x15,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xAC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x8B,0x16,0x84,0x0A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x01,0x01,0xE5,0x0A,0x2B,0x16,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAB,0x1E,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x05,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0x25,0x0B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xA2,0x01,0x86,0x0B,0x29,0x15,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0x4A,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x2E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xEA,0x15,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x22,0x01,0x08,0x15,0x0A,0x16,0x8B,0x16,0xAB,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAA,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0xC6,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0x24,0x0A,0xAA,0x15,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x26,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0xE3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xE3,0x01,0x88,0x14,0x4B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xEC,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x6B,0x16,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x40,0x00,0x01,0x01,0x07,0x0C,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x6B,0x16,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x01,0x07,0x0C,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x2E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0x23,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x00,0x09,0x15,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAA,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xA8,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE1,0x00,0xC2,0x01,0x84,0x02,0xE5,0x0A,0x25,0x0B,0x46,0x0B,0x25,0x0B,0x05,0x0B,0xC4,0x0A,0x23,0x02,0x62,0x01,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x01,0xAA,0x15,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x0C,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x2A,0x16,0x22,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x01,0x03,0x02,0x44,0x0A,0x64,0x0A,0xE5,0x0A,0x88,0x0C,0x89,0x15,0xCA,0x15,0x0A,0x16,0x4B,0x16,0x4B,0x16,0x4B,0x16,0x6B,0x16,0x6B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x6B,0x16,0x6B,0x16,0x6B,0x16,0x4B,0x16,0x4B,0x16,0x2B,0x16,0x0A,0x16,0xCA,0x15,0x69,0x15,0xA8,0x0C,0xC4,0x0A,0x64,0x0A,0x44,0x0A,0x03,0x02,0xA3,0x01,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xC6,0x0B,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x07,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0xA8,0x14,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x00,0xA1,0x00,0xE5,0x0A,0xA8,0x14,0x49,0x15,0x89,0x15,0x2B,0x16,0x6B,0x16,0x8B,0x16,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0x8B,0x16,0x8B,0x16,0x4B,0x16,0xCA,0x15,0x69,0x15,0x29,0x15,0x88,0x14,0xE3,0x01,0x81,0x00,0x80,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0xA6,0x0B,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xFF,0x07,0x00,0x00,0x00,0x00,0xAA,0x06,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x47,0x0C,0xA1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xE1,0x00,0x84,0x0A,0x05,0x0B,0xA8,0x14,0x2B,0x16,0x8B,0x16,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0x8B,0x16,0x2B,0x16,0x29,0x15,0x25,0x0B,0xC5,0x0A,0x03,0x02,0x60,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x89,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAA,0x06,0x00,0x00,0x00,0x00,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,
-    0x4B,0x16,0x84,0x0A,0x81,0x00,0x60,0x00,0x60,0x00,0x81,0x00,0xA1,0x00,0x25,0x0B,0x2A,0x16,0xAB,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0x8B,0x16,0xEA,0x15,0x84,0x02,0xA1,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x66,0x0B,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x00,0x00,0x00,0x00,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0x6B,0x16,0x0A,0x16,0xEA,0x15,0x4B,0x16,0x8B,0x16,0xAB,0x1E,0xAC,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x1E,0x8B,0x16,0x0A,0x16,0xC8,0x14,0xC6,0x0B,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x01,0xAB,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x00,0x00,0x00,0x00,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x16,0x6B,0x16,0xCA,0x15,0xC4,0x0A,0xE3,0x01,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x00,0x00,0x00,0x00,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0x6B,0x16,0x69,0x15,0x47,0x0C,0xA1,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x00,0x00,0xAA,0x2E,0xAC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x6B,0x16,0xA8,0x14,0xA4,0x0A,0xA1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x00,
-    0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAA,0x06,0xEC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xAC,0x1E,0x8B,0x16,0x86,0x0B,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x0A,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x16,0xEB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0x2B,0x16,0x47,0x0C,0x42,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0xC8,0x14,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAB,0x1E,
-    0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x4B,0x16,0xCA,0x15,0x49,0x15,0xE8,0x14,0xC8,0x14,0xC8,0x14,0xC8,0x14,0xC8,0x14,
-    0xC8,0x14,0xE8,0x14,0x49,0x15,0xCA,0x15,0x6B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x6B,0x16,0x88,0x14,0x82,0x01,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-    0xE3,0x01,0x8B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x4B,0x16,0x2B,0x16,0x2B,0x16,0x0A,0x16,0xE6,0x0B,0x03,0x02,0xE3,0x01,0xA3,0x01,0x82,0x01,0x82,0x01,0x82,0x01,0x42,0x01,0xE1,0x00,0x80,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x81,0x00,0xE1,0x00,0x42,0x01,0x82,0x01,0x82,0x01,0x82,0x01,0xC3,0x01,0xE3,0x01,0x03,0x02,0xE6,0x0B,0x0A,0x16,0x2B,0x16,0x2B,0x16,0x4B,0x16,0x8B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x2B,0x16,0x47,0x0C,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x02,0x2A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x6B,0x16,0x6B,0x16,0xAA,0x15,0x47,0x0C,0x07,0x0C,0x86,0x0B,0x01,0x01,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x80,0x00,0xC4,0x0A,0xE7,0x0B,0x27,0x0C,0x67,0x14,
-    0x2B,0x16,0x6B,0x16,0x8B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x2A,0x16,0x05,0x0B,0xC1,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xC1,0x00,0xE5,0x0A,0x4B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCB,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x1E,0x8B,0x16,0x6B,0x16,0x49,0x15,0xC1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x01,0x01,0x69,0x15,0x8B,0x16,0x8B,0x16,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x4B,0x16,0x49,0x15,0x69,0x15,0x4B,0x16,0xAB,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x2B,0x16,0xE5,0x0A,0x24,0x0A,0xA1,0x00,0x40,0x00,0x20,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xE1,0x00,0x44,0x0A,0xA4,0x0A,0x89,0x15,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x2B,0x16,0xA8,0x14,0xE1,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xA1,0x00,0x25,0x0B,0xC8,0x14,0xEA,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x4B,0x16,0x62,0x01,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0xC3,0x01,0x87,0x0C,0x4B,0x16,0xAB,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x6B,0x16,0x03,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x45,0x0B,0x67,0x0C,
-    0x6B,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x89,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x45,0x0B,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0x25,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x44,0x0A,0xC8,0x14,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0xC3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x62,0x01,0x08,0x15,0x4B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0xA2,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x01,0xC6,0x0B,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0xA4,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,
-    0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x01,0x88,0x14,0x8B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x49,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x01,0xE8,0x0C,0x8B,0x16,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0x8B,0x16,0x08,0x0D,0xC2,0x01,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0xAA,0x15,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x4B,0x16,0xC3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x01,0x07,0x0C,0x27,0x0C,0x27,0x0C,0x29,0x15,0x6B,0x16,0x6B,0x16,0x6B,0x16,0x6B,0x16,0x8B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x8B,0x16,0x6B,0x16,0x6B,0x16,0x6B,0x16,0x6B,0x16,
-    0x89,0x15,0x47,0x0C,0x47,0x0C,0x27,0x0C,0x84,0x0A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x44,0x02,0x0A,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x0A,0x16,0x42,0x01,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x62,0x01,0xC3,0x01,0x25,0x0B,0x2A,0x16,0x2B,0x16,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x8B,0x16,0x4B,0x16,0x2B,0x16,0x49,0x15,0x23,0x02,0xC3,0x01,0xE1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0xC8,0x14,
-    0xAB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x0A,0x16,0x07,0x0C,
-    0xA1,0x00,0x80,0x00,0x80,0x00,0x81,0x00,0x62,0x01,0xA8,0x14,0x08,0x15,0x6B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCA,0x15,0xE8,0x14,0x67,0x0C,0x01,0x01,0x80,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0x29,0x15,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0x45,0x0B,0x44,0x0A,0xA1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x01,0x6B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xAB,0x1E,0x8B,0x16,0x4B,0x16,0x42,0x01,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x60,0x00,0x29,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xAC,0x1E,0x8B,0x16,0x4B,0x16,0x27,0x0C,0x64,0x0A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x67,0x0C,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x8B,0x16,0x0A,0x16,0x44,0x02,0xE1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x07,0x0C,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAA,0x15,0x27,0x0C,0xA1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x88,0x14,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xEB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0xA6,0x0B,0x62,0x01,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x69,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAB,0x1E,0x8C,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x8B,0x16,0x08,0x15,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x01,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x16,0xAA,0x2E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x2A,0x16,0xA6,0x0B,0xC1,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x01,0xCA,0x15,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAA,0x06,0x00,0x00,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0x8B,0x16,0x6B,0x16,0x0A,0x16,0x89,0x15,0x49,0x15,0x49,0x15,0x29,0x15,0x08,0x15,0xE8,0x14,0xC8,0x14,0xA8,0x14,0xA8,0x14,0x88,0x14,0x88,0x14,0x88,0x14,0xA8,0x14,0xA8,0x14,0xC8,0x14,0xC8,0x14,0x08,0x15,0x29,0x15,0x49,0x15,0x49,0x15,0x89,0x15,0x2B,0x16,0x8B,0x16,0x8B,0x16,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0x4B,0x16,0x64,0x0A,0x81,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x62,0x01,0xCA,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x00,0x00,0x00,0x00,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x1E,0x8B,0x16,0x6B,0x16,0x4B,0x16,0x0A,0x16,0xAA,0x15,0xC6,0x0B,0x44,0x0A,0x44,0x0A,0x03,0x02,0xE3,0x01,0x42,0x01,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x62,0x01,0x03,0x02,0x23,0x0A,0x44,0x0A,0xE5,0x0A,0x49,0x15,0x0A,0x16,0x4B,0x16,0x8B,0x16,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x49,0x15,0x88,0x14,0x67,0x14,0x68,0x14,0xE8,0x14,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x00,0x00,0x00,0x00,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAC,0x1E,0xAB,0x1E,0x8B,0x16,0x6B,0x16,0xEA,0x15,0xC8,0x14,0x67,0x0C,0xC6,0x0B,0x82,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x02,0x27,0x0C,0xA8,0x14,0xEA,0x15,0x6B,0x16,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x00,0x00,0x00,0x00,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0x0A,0x16,0x47,0x0C,0xE1,0x00,0x81,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x81,0x00,0x43,0x02,
-    0xCA,0x15,0x8B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x00,0x00,0x00,0x00,0xAA,0x06,
-    0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x4B,0x16,0x66,0x0B,0x01,0x01,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xA1,0x00,0xA4,0x0A,0x66,0x0B,0xEA,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAA,0x06,0x00,0x00,0x00,0x00,0xFF,0x07,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x8B,0x16,0xE5,0x0A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x82,0x01,0x09,0x15,0x0A,0x16,0x8B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xFF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x49,0x15,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x01,0x64,0x0A,0xAA,0x15,0x8B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAC,0x1E,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x0C,0x1F,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xE5,0x0A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x02,0xE8,0x14,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x2E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xC3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xE1,0x00,0xE8,0x14,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAA,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x04,0xCB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x23,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xA3,0x01,0x07,0x0C,0x6B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x10,0x04,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x27,0x0C,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x60,0x00,0xE1,0x00,0x01,0x01,0x42,0x01,0xA2,0x01,0x03,0x02,0x44,0x0A,0xE5,0x0A,0x27,0x0C,0x49,0x15,0x0A,0x16,0x2A,0x16,
-    0x2A,0x16,0x2A,0x16,0x2A,0x16,0x2A,0x16,0x2A,0x16,0x69,0x15,0x67,0x0C,0xE5,0x0A,0x44,0x0A,0xE3,0x01,0x82,0x01,0x22,0x01,0x01,0x01,0x81,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x01,0x69,0x15,0x6B,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x26,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x4B,0x16,0xA2,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xA1,0x00,0x22,0x01,0xA4,0x0A,0x27,0x0C,0x47,0x0C,0xA8,0x14,0x09,0x15,0x4B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x89,0x15,0xC8,0x14,0x67,0x0C,0x07,0x0C,0x03,0x02,0xE1,0x00,0x60,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x60,0x00,0x23,0x0A,0xAA,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xEC,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x49,0x15,0x42,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x01,0x01,0xE3,0x01,0x84,0x0A,0x07,0x0C,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,
-    0x27,0x0C,0x44,0x0A,0x62,0x01,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x00,0xC8,0x14,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x2E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x4B,0x16,0x49,0x15,0x23,0x02,0x03,0x02,0xE8,0x14,0xEA,0x15,0x4B,0x16,0x8B,0x16,0x8B,0x16,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0x8B,0x16,0x6B,0x16,0xEA,0x15,0x69,0x15,0xC3,0x01,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x09,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAA,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x05,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x8B,0x16,0x8B,0x16,0xAB,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x8B,0x16,0x2B,0x16,0x07,0x0C,0xA4,0x0A,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x44,0x0A,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0x4A,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xAB,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x8B,0x16,0x4B,0x16,0xA6,0x0B,0xE1,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xEB,0x1E,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x6B,0x16,0x88,0x14,0x23,0x02,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x4B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x69,0x15,0xE3,0x01,0x40,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAB,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x6B,0x16,0x89,0x15,0xE3,0x01,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x44,0x02,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x16,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0x6B,0x16,0xA8,0x14,0x82,0x01,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0x49,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x25,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x6B,0x16,0xE6,0x0B,0xA1,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x01,0x01,0x69,0x15,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAC,0x1E,0xEC,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xCC,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x2A,0x16,0x88,0x14,0x27,0x0C,0xA8,0x14,0x2B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x16,0xCC,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x26,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCD,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,
-    0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xAB,0x1E,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x8B,0x16,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0x8B,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x16,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x6B,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x07,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xEA,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x07,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x16,0xEC,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x05,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0x6C,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0x8B,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x05,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x26,0xEC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xC9,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x26,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xAB,0x1E,0xEC,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x16,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,
-    0x6C,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x17,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAA,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x1F,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0x6C,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x6C,0x06,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAB,0x1E,0x6C,0x06,
-    0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xAA,0x2E,0xAB,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAC,0x16,0xAA,0x2E,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x05,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xF0,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x04,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCB,0x1E,0x10,0x04,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x05,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x05,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x07,0x8C,0x16,0xCB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCC,0x1E,0xEC,0x16,0xEA,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x2E,0xAC,0x16,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x16,0xAA,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0xCC,0x16,0xAC,0x1E,0xCC,0x1E,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xCC,0x16,0xEC,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x6C,0x06,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0x8B,0x16,0x6C,0x06,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x8B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xAB,0x1E,0x8B,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x26,0xCB,0x16,0xAC,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCD,0x26,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x04,0xCC,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x16,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x07,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xAA,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xAA,0x06,0x0A,0x1F,0xCC,0x16,
-    0xCB,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCB,0x1E,0xCC,0x1E,0xAC,0x1E,0x0A,0x1F,0xAA,0x06,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xCD,0x26,0x8B,0x16,0xCB,0x1E,0xCB,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,
-    0xCB,0x16,0xCC,0x1E,0xEB,0x16,0xCD,0x26,0x4A,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x04,0xEC,0x25,0xEC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,
-    0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x16,0xCC,0x1E,0xCB,0x1E,0xEC,0x16,0xEC,0x26,0xF0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x1F,0xAB,0x16,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0xCC,0x1E,0xCC,0x16,0xAB,0x16,0xAC,0x1E,0xCC,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCB,0x1E,0xCC,0x16,0xCC,0x1E,0xCC,0x16,0xCC,0x1E,0xAB,0x1E,0xAC,0x16,0xAB,0x1E,0xCC,0x1E,0x6C,0x16,0x8B,0x16,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    //alpha channel data:
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0B,0x19,0x28,
-    0x36,0x59,0x7C,0x9D,0xBB,0xD3,0xE6,0xF4,0xF5,0xF6,0xF7,0xF7,0xF6,0xF5,0xF4,0xE6,0xD3,0xBB,0x9E,0x7F,0x59,0x37,0x28,0x1A,0x0C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x08,0x0F,0x37,0x72,0xA5,0xC5,0xD6,0xE6,0xF2,0xF7,0xF9,0xFA,0xFC,0xFD,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFC,0xFB,0xF9,0xF7,0xF3,0xE7,0xD7,0xC6,0xA7,0x72,0x37,0x0F,0x08,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x07,0x16,0x3C,0x63,0xA2,0xD9,0xF4,0xF9,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF9,0xF4,0xDB,0xA2,0x65,0x3D,0x17,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x06,0x09,0x2A,0x95,0xE3,0xF3,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF3,0xE3,0x96,0x2C,0x09,0x06,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x3D,0x8B,0xD0,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xD1,0x8D,0x3F,0x06,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x1A,0x56,0xCC,0xF7,0xFA,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFA,0xF7,0xCD,0x58,0x1B,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x07,0x22,0x92,0xD5,0xF5,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xF5,0xD6,0x93,0x22,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x0B,0x35,0x8B,0xEB,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFB,0xEC,0x8C,0x36,0x0B,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x05,0x16,0xA0,0xEE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xEE,0xA1,0x17,0x05,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x84,0xE8,0xFE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE8,0x84,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0D,
-    0x54,0xE0,0xFA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFA,0xE1,0x55,0x0D,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x3A,0xB6,0xF4,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF4,0xB7,0x3B,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x17,0x6C,0xE8,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xE8,0x6D,0x18,0x03,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x1C,0xC2,0xFA,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xC3,0x1D,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x68,0xE6,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xE6,0x68,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x14,0x9F,0xF8,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFD,0xF8,0x9F,0x14,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x32,0xC0,0xF8,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xC0,0x32,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x3D,0xD6,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xD6,0x3E,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x05,0x56,0xEB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEB,0x57,0x05,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x73,0xF3,0xFE,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF4,0x73,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x77,0xF6,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF6,0x78,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x87,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x87,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0x83,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x84,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x7D,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x7C,0x04,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x73,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0x74,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x4B,0xF3,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF3,0x4B,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x4B,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,
-    0x4B,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x23,0xD4,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xD5,0x23,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xCB,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xCB,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x95,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xF9,0x95,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x68,0xF8,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF8,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x29,0xE0,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xDF,0x29,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC2,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x7A,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x7A,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xE2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE2,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0C,0xCD,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xCC,0x0B,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x5E,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x5E,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x13,0xDF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xE0,0x13,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x8D,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x8D,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x22,0xE4,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE4,0x22,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x96,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x95,0x08,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x39,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x38,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x92,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x92,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xE3,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x1F,0xE3,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE3,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x5F,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xF5,0x5E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xC1,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xC0,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x35,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x35,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x92,0xFC,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x92,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xCF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xCF,0x14,0x00,0x00,0x00,0x00,0x00,0x02,0x31,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x30,0x02,0x00,0x00,0x00,0x00,0x06,0x88,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x88,0x06,0x00,0x00,0x00,0x00,0x13,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x12,0x00,0x00,0x00,0x00,0x41,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x40,0x00,0x00,0x00,0x01,0x73,0xFB,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x73,0x01,0x00,0x00,0x06,0xA3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA3,0x06,0x00,0x00,0x0D,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x0D,0x00,0x00,0x26,0xF1,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x25,0x00,0x00,0x67,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x66,0x00,0x00,0xA8,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xA7,0x00,0x06,0xD9,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xD8,0x06,0x1D,0xE4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0x1D,0x33,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x33,
-    0x47,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x47,0x5F,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x5E,0x7D,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xF9,0x7D,0x9B,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x9A,0xB3,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xB2,0xC9,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFC,0xC8,0xDA,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xD9,0xE9,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE8,0xF2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFE,0xF2,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xF2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF2,0xE8,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE8,0xDA,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xD9,0xC8,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xC8,0xB3,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xB2,0x9B,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x9A,0x7D,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x7C,0x5E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x5E,0x47,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x47,0x33,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x33,0x1D,0xE4,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x1C,0x06,0xD8,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xD8,0x06,0x00,0xA7,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xA7,0x00,0x00,0x67,0xF8,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x66,0x00,0x00,0x26,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x25,0x00,0x00,0x0D,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x0D,0x00,0x00,0x06,
-    0xA3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA2,0x06,0x00,0x00,0x01,0x73,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x72,0x01,0x00,0x00,0x00,0x41,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x40,0x00,0x00,
-    0x00,0x00,0x12,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x12,0x00,0x00,0x00,0x00,0x06,0x87,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x88,0x06,0x00,0x00,0x00,0x00,0x02,0x31,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x30,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x15,0xCF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xCF,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x92,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x92,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x35,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x34,
-    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xC0,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xC0,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x5E,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x5E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x1F,0xE3,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE2,
-    0x1E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x92,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,
-    0x91,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x38,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x38,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x94,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x94,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x22,0xE4,0xFE,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-    0xE4,0x22,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x8D,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x8C,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x13,0xDF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xDE,0x13,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
-    0x5E,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xF3,0x5E,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0B,0xCC,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xCC,0x0B,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xE2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE1,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x02,0x79,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFC,0x79,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xC1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x28,0xDF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xDF,0x28,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x67,0xF8,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-    0xF8,0x66,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x94,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x94,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xCB,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xCB,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x23,0xD4,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,
-    0xD4,0x23,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x4B,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x4A,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x49,0xF2,0xFE,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF2,0x4B,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x72,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,
-    0x73,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x7C,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x7C,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0x82,
-    0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x84,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x86,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x87,
-    0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x76,0xF5,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF6,0x76,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x09,0x72,0xF3,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF3,0x72,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x05,0x55,0xEB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEB,0x56,0x05,
-    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x3D,0xD6,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xD6,0x3D,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x31,0xBF,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xBF,0x31,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x14,0x9D,0xF8,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF8,0x9E,0x14,0x02,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x66,0xE5,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xE5,0x67,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x04,0x1B,0xC1,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xC2,0x1C,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x17,0x6B,0xE8,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xE8,0x6C,0x17,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x39,0xB5,
-    0xF3,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF3,0xB6,0x39,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0D,0x52,0xE0,0xFA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFA,0xE0,0x54,0x0D,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x82,0xE7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xE8,0x84,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x02,0x05,0x15,0x9F,0xED,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xEE,0xA0,0x16,0x05,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0B,0x35,0x8A,0xEB,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xEC,0x8B,0x36,0x0B,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x07,0x21,0x92,0xD5,0xF5,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xF5,0xD5,0x92,0x22,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x1A,0x55,0xCB,0xF7,0xFA,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFD,0xFA,0xF7,0xCB,0x57,0x1B,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x3C,0x8A,0xCF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xD0,0x8C,0x3D,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x06,0x09,0x27,
-    0x93,0xE2,0xF3,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF3,0xE3,0x95,0x2A,0x09,0x06,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x07,0x16,0x3C,0x62,0xA0,0xD8,0xF4,0xF9,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF9,0xF4,0xD9,0xA1,
-    0x63,0x3C,0x16,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x08,0x0F,0x35,0x70,0xA4,0xC4,0xD5,0xE5,0xF2,0xF7,0xF9,0xFA,0xFC,0xFD,0xFE,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFD,0xFC,0xFB,0xF9,0xF7,0xF2,0xE6,0xD6,0xC5,0xA6,0x71,0x36,0x0F,0x08,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x19,0x27,0x35,0x58,0x7B,0x9B,0xB9,0xD2,0xE4,0xF3,0xF5,0xF6,0xF7,0xF7,0xF6,0xF5,0xF3,0xE4,0xD2,0xBB,0x9E,0x7E,0x58,0x36,0x27,0x1A,0x0B,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x62,0x15,0x08,0x16,0x4B,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x01,0xA2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x62,0x0B,0xC6,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x0A,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,
+    0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x22,0x14,0x88,0x16,0x8B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x15,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x62,0x0C,0xE8,0x16,0x8B,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x16,0x8B,0x0D,0x08,0x01,0xC2,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x15,0xAA,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,0x16,0x4B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x4B,0x01,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x62,0x0C,0x07,0x0C,0x27,0x0C,0x27,0x15,0x29,0x16,0x6B,0x16,0x6B,0x16,0x6B,0x16,0x6B,0x16,0x8B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x8B,0x16,0x6B,0x16,0x6B,0x16,0x6B,0x16,0x6B,
+    0x15,0x89,0x0C,0x47,0x0C,0x47,0x0C,0x27,0x0A,0x84,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x02,0x44,0x16,0x0A,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x2B,0x15,0xEA,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x0A,0x01,0x42,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x62,0x01,0xC3,0x0B,0x25,0x16,0x2A,0x16,0x2B,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x8B,0x16,0x4B,0x16,0x2B,0x15,0x49,0x02,0x23,0x01,0xC3,0x00,0xE1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x14,0xC8,
+    0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0xEA,0x15,0x6A,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x0A,0x0C,0x07,
+    0x00,0xA1,0x00,0x80,0x00,0x80,0x00,0x81,0x01,0x62,0x14,0xA8,0x15,0x08,0x16,0x6B,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0xCA,0x14,0xE8,0x0C,0x67,0x01,0x01,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x15,0x29,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x15,0x6A,0x14,0xE8,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x0B,0x45,0x0A,0x44,0x00,0xA1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x21,0x16,0x6B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0xE9,0x14,0x48,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x1E,0xAB,0x16,0x8B,0x16,0x4B,0x01,0x42,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x60,0x15,0x29,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0x48,0x13,0xA7,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xAC,0x16,0x8B,0x16,0x4B,0x0C,0x27,0x0A,0x64,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0C,0x67,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x13,0xA7,0x12,0xE6,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x8B,0x16,0x0A,0x02,0x44,0x00,0xE1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0C,0x07,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x12,0xE6,0x12,0x65,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0xAA,0x0C,0x27,0x00,0xA1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x14,0x88,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x12,0x65,0x11,0xE4,0x16,0x4B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x0B,0xA6,0x01,0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x15,0x69,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x4A,0x11,0xE4,0x11,0x64,0x16,0x2B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x8B,0x15,0x08,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x82,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x2B,0x11,0x64,0x10,0xC3,0x15,0xEA,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x16,0x2A,0x0B,0xA6,0x00,0xC1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x15,0xCA,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0xEA,0x10,0xC3,0x10,0xA3,0x14,0xA9,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x1E,0xAB,0x16,0x8B,0x16,0x6B,0x16,0x0A,0x15,0x89,0x15,0x49,0x15,0x49,0x15,0x29,0x15,0x08,0x14,0xE8,0x14,0xC8,0x14,0xA8,0x14,0xA8,0x14,0x88,0x14,0x88,0x14,0x88,0x14,0xA8,0x14,0xA8,0x14,0xC8,0x14,0xC8,0x15,0x08,0x15,0x29,0x15,0x49,0x15,0x49,0x15,0x89,0x16,0x2B,0x16,0x8B,0x16,0x8B,0x1E,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x16,0x4B,0x0A,0x64,0x00,0x81,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x60,0x01,0x62,0x15,0xCA,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0xA9,0x10,0xA3,0x10,0xA3,0x13,0x26,0x16,0xAC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x1E,0xAB,0x16,0x8B,0x16,0x6B,0x16,0x4B,0x16,0x0A,0x15,0xAA,0x0B,0xC6,0x0A,0x44,0x0A,0x44,0x02,0x03,0x01,0xE3,0x01,0x42,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x01,0x62,0x02,0x03,0x0A,0x23,0x0A,0x44,0x0A,0xE5,0x15,0x49,0x16,0x0A,0x16,0x4B,0x16,0x8B,0x1E,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0x49,0x14,0x88,0x14,0x67,0x14,0x68,0x14,0xE8,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x13,0x06,0x10,0xA3,0x10,0xA3,0x11,0x84,0x16,0x6B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAC,0x1E,0xAB,0x16,0x8B,0x16,0x6B,0x15,0xEA,0x14,0xC8,0x0C,0x67,0x0B,0xC6,0x01,0x82,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x43,0x0C,0x27,0x14,0xA8,0x15,0xEA,0x16,0x6B,0x1E,0xAB,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x11,0x84,0x10,0xA3,0x10,0xA3,0x11,0x03,0x15,0xAA,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x16,0x0A,0x0C,0x47,0x00,0xE1,0x00,0x81,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x81,0x02,0x43,
+    0x15,0xCA,0x16,0x8B,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0xAA,0x11,0x03,0x10,0xA3,0x10,0xA3,0x10,0xC3,
+    0x14,0x88,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x4B,0x0B,0x66,0x01,0x01,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xA1,0x0A,0xA4,0x0B,0x66,0x15,0xEA,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x14,0x88,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x13,0x66,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x0A,0xE5,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x01,0x82,0x15,0x09,0x16,0x0A,0x16,0x8B,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x13,0x67,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x12,0x45,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0x49,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x22,0x0A,0x64,0x15,0xAA,0x16,0x8B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x12,0x25,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x11,0x23,0x16,0x0B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x0A,0xE5,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x23,0x14,0xE8,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x0B,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0xE8,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x01,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xE1,0x14,0xE8,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x13,0xE8,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0xE4,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x02,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0xA3,0x0C,0x07,0x16,0x6B,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x11,0xC4,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x15,0xAA,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x0C,0x27,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x60,0x00,0xE1,0x01,0x01,0x01,0x42,0x01,0xA2,0x02,0x03,0x0A,0x44,0x0A,0xE5,0x0C,0x27,0x15,0x49,0x16,0x0A,0x16,0x2A,
+    0x16,0x2A,0x16,0x2A,0x16,0x2A,0x16,0x2A,0x16,0x2A,0x15,0x69,0x0C,0x67,0x0A,0xE5,0x0A,0x44,0x01,0xE3,0x01,0x82,0x01,0x22,0x01,0x01,0x00,0x81,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x62,0x15,0x69,0x16,0x6B,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0xAA,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x14,0x28,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x4B,0x01,0xA2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0xA1,0x01,0x22,0x0A,0xA4,0x0C,0x27,0x0C,0x47,0x14,0xA8,0x15,0x09,0x16,0x4B,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x15,0x89,0x14,0xC8,0x0C,0x67,0x0C,0x07,0x02,0x03,0x00,0xE1,0x00,0x60,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x60,0x0A,0x23,0x15,0xAA,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0x28,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0xE5,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0x49,0x01,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x01,0x01,0xE3,0x0A,0x84,0x0C,0x07,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,
+    0x0C,0x27,0x0A,0x44,0x01,0x62,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x14,0xC8,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x11,0xE5,
+    0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x15,0x4A,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x4B,0x15,0x49,0x02,0x23,0x02,0x03,0x14,0xE8,0x15,0xEA,0x16,0x4B,0x16,0x8B,0x16,0x8B,0x1E,0xAB,0x1E,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x1E,0xAB,0x16,0x8B,0x16,0x6B,0x15,0xEA,0x15,0x69,0x01,0xC3,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x15,0x09,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x15,0x2A,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0xE6,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x8B,0x16,0x8B,0x1E,0xAB,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x8B,0x16,0x2B,0x0C,0x07,0x0A,0xA4,0x00,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0A,0x44,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x12,0xE6,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x64,0x16,0x2A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x8B,0x16,0x4B,0x0B,0xA6,0x00,0xE1,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x0B,
+    0x11,0x64,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x14,0x28,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x14,0x88,0x02,0x23,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x16,0x4B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0x28,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x44,0x16,0x2B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0x69,0x01,0xE3,0x00,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x2A,0x11,0x44,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x14,0x28,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x6B,0x15,0x89,0x01,0xE3,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x02,0x44,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,
+    0x14,0x28,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x12,0x05,0x16,0x6B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAB,0x16,0x6B,0x14,0xA8,0x01,0x82,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x15,0x49,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x12,0x05,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x14,0x48,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x6B,0x0B,0xE6,0x00,0xA1,0x00,0x40,0x00,0x20,0x00,0x40,0x01,0x01,0x15,0x69,0x1E,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCB,0x14,0x28,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x84,0x16,0x2B,0x16,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xAC,0x16,0x2A,0x14,0x88,0x0C,0x27,0x14,0xA8,0x16,0x2B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,
+    0x16,0x2B,0x11,0x84,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x14,0x08,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x13,0xE8,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x16,0x0B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x0B,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,
+    0x12,0xE6,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x16,0x8B,0x12,0xE6,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x15,0x8A,0x16,0xAB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAB,0x15,0x8A,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0xC4,0x16,0x0B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x0B,0x11,0xC4,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0x87,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x16,0xAC,0x13,0x87,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x15,0x29,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x15,0x4A,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0xA4,0x16,0x0B,0x16,0xCB,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCB,0x16,0x0B,0x11,0xA4,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0x26,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,
+    0x16,0xAC,0x13,0x26,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x14,0x28,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x14,0x48,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x15,0x8A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0x8A,0x11,0x23,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x84,0x15,0xCA,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,
+    0x15,0xCA,0x11,0x84,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0x65,0x16,0x4B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x4B,0x12,0x65,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x12,0x65,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,0x12,0x65,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x13,0x67,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,
+    0x13,0x66,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0xA7,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x13,0xA7,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x03,0x13,0xC7,
+    0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x13,0xC7,0x11,0x03,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x13,0xC7,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x13,0xE7,
+    0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x03,0x13,0x86,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,0x13,0x86,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x13,0x67,0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,0x13,0x67,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0xC6,0x16,0x4A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x4A,0x12,0xA5,0x10,0xC3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0x25,0x15,0xC9,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x15,0xC9,0x12,0x25,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0xC4,0x15,0x49,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x15,0x49,0x11,0xE4,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x23,0x14,0x68,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xAC,0x14,0x68,0x11,0x23,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x13,0x26,0x16,0x2B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x2B,0x13,0x26,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0x44,0x15,0x4A,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x15,0x4A,0x11,0x64,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x11,0x24,0x13,0x46,0x16,0x2B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x2B,0x13,0x47,0x11,0x44,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0x05,0x15,0x09,
+    0x16,0x8B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8B,0x15,0x08,0x12,0x05,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x03,0x12,0xA6,0x16,0x0B,0x16,0x8C,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8C,0x16,0x0B,0x12,0xA6,0x11,0x03,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x64,0x13,0xC7,0x16,0x2B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xCC,0x16,0x2B,0x13,0xC7,0x11,0x64,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x10,0xC3,0x11,0x23,0x14,0x88,0x16,0x6B,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x4A,0x14,0x88,0x11,0x23,0x10,0xC3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x11,0xE5,0x14,0x08,0x16,0x4B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0x4B,0x14,0x07,0x11,0xE4,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x11,0x84,0x14,0x28,0x15,0xAA,0x16,0x8B,0x16,0xAC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xAC,0x16,0x8B,0x15,0xCA,0x14,0x28,0x11,0x84,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x11,0x44,0x12,0xA6,0x15,0x8A,0x16,0x8B,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xAC,0x16,0x8B,0x15,0x8A,0x12,0xC6,0x11,0x44,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x12,0x25,0x14,0x08,0x15,0xAA,0x16,0x8B,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0x8B,0x15,0xAA,0x13,0xE7,0x12,0x25,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x10,0xC3,0x10,0xE3,0x11,0xA4,
+    0x14,0x27,0x16,0x0B,0x16,0x8A,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0x8A,0x16,0x2A,0x14,0x48,0x11,0xA4,0x10,0xE3,0x10,0xC3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xC3,0x10,0xE3,0x11,0x23,0x12,0x25,0x13,0x06,0x14,0x88,0x15,0xEA,0x16,0x8B,0x16,0xAC,0x16,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xAC,0x16,0x8B,0x15,0xEA,0x14,0x68,
+    0x13,0x06,0x12,0x25,0x11,0x43,0x10,0xE3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x11,0x03,0x11,0xE5,0x13,0x67,0x14,0xA9,0x15,0x6A,0x15,0xCA,0x16,0x2B,0x16,0x8B,0x16,0x8B,0x16,0xAC,0x16,0xAC,0x16,0xAC,0x16,0xCC,0x16,0xCC,0x1E,0xCC,
+    0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x1E,0xCC,0x16,0xCC,0x16,0xCC,0x16,0xAC,0x16,0x8B,0x16,0xAC,0x16,0x8B,0x16,0x8B,0x16,0x0A,0x15,0xCA,0x15,0x6A,0x14,0x88,0x13,0x67,0x12,0x04,0x11,0x03,0x10,0xE3,0x10,0xC3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE3,0x11,0x44,0x11,0xA4,0x11,0xE5,0x12,0xC6,0x13,0xA7,0x14,0x68,0x15,0x09,0x15,0xAA,0x16,0x2B,0x16,0x8A,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8B,0x16,0x8A,0x16,0x2B,0x15,0xAA,0x15,0x29,0x14,0x68,0x13,0xA7,0x12,0xC6,0x11,0xE4,0x11,0xA4,0x11,0x44,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
+    0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,
 };
 const lv_image_dsc_t ui_img_1011443021 = {
     .header.w = 150,
     .header.h = 150,
     .data_size = sizeof(ui_img_1011443021_data),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .header.cf = LV_COLOR_FORMAT_RGB565_SWAPPED,
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .data = ui_img_1011443021_data
 };
@@ -0,0 +1,94 @@
+"""Pre-swap the SquareLine image assets for an RGB565_SWAPPED display.
+
+LVGL renders in the panel's byte order (LV_COLOR_FORMAT_RGB565_SWAPPED), so
+images stored the same way are drawn with a plain copy. SquareLine exports
+little-endian RGB565, so this runs before every build (extra_scripts = pre:)
+and rewrites lib/ui/src/ui_img_*.c in place:
+
+  - RGB565 images are byte-swapped.
+  - RGB565A8 images listed in FLATTEN are composited over the colour they
+    always sit on, then swapped. This also drops their alpha plane.
+  - Other images with alpha are left alone. LVGL has no swapped format with
+    alpha, and their alpha blend reads every pixel anyway.
+
+Converted files are marked and skipped, so re-exporting from SquareLine and
+building again is enough. Can also be run by hand: python scripts/preswap_images.py
+"""
+
+import glob
+import os
+import re
+
+# Image -> background it is drawn on (0xRRGGBB)
+FLATTEN = {
+    "ui_img_1011443021": 0x15171A,  # cover placeholder on the dark theme screen
+}
+
+MARKER = "// Pre-swapped for LV_COLOR_FORMAT_RGB565_SWAPPED by scripts/preswap_images.py"
+BYTES_PER_LINE = 128
+
+
+def swapped(color):
+    return [color >> 8, color & 0xFF]
+
+
+def flatten(rgb565, alpha, bg):
+    r = (rgb565 >> 11) * 255 // 31
+    g = ((rgb565 >> 5) & 0x3F) * 255 // 63
+    b = (rgb565 & 0x1F) * 255 // 31
+    br, bgc, bb = bg >> 16, (bg >> 8) & 0xFF, bg & 0xFF
+    r = (r * alpha + br * (255 - alpha)) // 255
+    g = (g * alpha + bgc * (255 - alpha)) // 255
+    b = (b * alpha + bb * (255 - alpha)) // 255
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def convert(path):
+    name = os.path.basename(path)[:-2]
+    source = open(path).read()
+    if MARKER in source:
+        return False
+
+    cf = re.search(r"\.header\.cf = (\w+)", source).group(1)
+    width = int(re.search(r"\.header\.w = (\d+)", source).group(1))
+    height = int(re.search(r"\.header\.h = (\d+)", source).group(1))
+    data = re.search(r"(_data\[\] = \{)(.*?)(\};)", source, re.S)
+    raw = [int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]{2}", data.group(2))]
+    pixels = width * height
+
+    if cf in ("LV_COLOR_FORMAT_RGB565", "LV_COLOR_FORMAT_NATIVE"):
+        out = []
+        for i in range(pixels):
+            out += swapped(raw[2 * i] | raw[2 * i + 1] << 8)
+    elif cf in ("LV_COLOR_FORMAT_RGB565A8", "LV_COLOR_FORMAT_NATIVE_WITH_ALPHA") and name in FLATTEN:
+        out = []
+        for i in range(pixels):
+            color = raw[2 * i] | raw[2 * i + 1] << 8
+            out += swapped(flatten(color, raw[2 * pixels + i], FLATTEN[name]))
+    else:
+        return False
+
+    lines = []
+    for i in range(0, len(out), BYTES_PER_LINE):
+        lines.append("    " + "".join("0x%02X," % b for b in out[i:i + BYTES_PER_LINE]))
+    body = "\n" + "\n".join(lines) + "\n"
+
+    source = source[:data.start(2)] + body + source[data.end(2):]
+    source = source.replace(".header.cf = " + cf, ".header.cf = LV_COLOR_FORMAT_RGB565_SWAPPED")
+    source = re.sub(r"(// IMAGE DATA:.*\n)", r"\1" + MARKER + "\n", source, count=1)
+    open(path, "w").write(source)
+    return True
+
+
+def run(project_dir):
+    for path in sorted(glob.glob(os.path.join(project_dir, "lib", "ui", "src", "ui_img_*.c"))):
+        if convert(path):
+            print("preswap_images: converted " + os.path.basename(path))
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    run(env["PROJECT_DIR"])  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        run(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
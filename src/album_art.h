@@ -0,0 +1,266 @@
+#ifndef ALBUM_ART_H
+#define ALBUM_ART_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include "art_cache.h"
+#include "latency_stats.h"
+extern "C" {
+#include "src/libs/tjpgd/tjpgd.h"   // LVGL's bundled TJPGD (LV_USE_TJPGD)
+}
+
+// Album art loader
+// Runs as a low-priority task on core 1, in the time the render task leaves idle.
+// The JPEG is streamed from the HTTP body straight into TJPGD (the file is
+// never buffered), scaled by TJPGD by the largest power of two that keeps it
+// at least ART_SIZE, and centre-cropped into an RGB565 buffer in the panel's
+// byte order (RGB565_SWAPPED), so drawing it is a plain copy. Decoded covers
+// go into the LittleFS LRU, so a repeated album costs one flash read.
+// Buffer ownership: the UI switches ui_Image3 to the placeholder before
+// calling request(); the task then owns the buffer until takeReady() hands
+// it back for display.
+
+#define ART_SIZE 150
+
+class AlbumArt {
+private:
+    struct ArtJob {
+        char albumId[23];
+        char url[128];
+        uint32_t generation;
+    };
+
+    struct DecodeContext {
+        WiFiClient* in;
+        int remaining;              // -1 if the length is unknown
+        uint16_t* out;
+        uint16_t offsetX;
+        uint16_t offsetY;
+        uint32_t bytes;
+    };
+
+#if JD_FASTDECODE == 2
+    static const size_t WORK_POOL_SIZE = 10 * 1024;   // includes the Huffman lookup tables
+#else
+    static const size_t WORK_POOL_SIZE = 4 * 1024;
+#endif
+    static const uint32_t MIN_HEAP = 40 * 1024;        // TLS handshake plus the TJPGD pool
+    static const size_t PIXEL_BYTES = ART_SIZE * ART_SIZE * sizeof(uint16_t);
+
+    QueueHandle_t jobs = NULL;
+    uint16_t* pixels = nullptr;
+    lv_image_dsc_t dsc;
+    ArtCache cache;
+
+    volatile uint32_t wanted = 0;       // generation the UI is waiting for
+    volatile uint32_t readyGen = 0;     // generation whose pixels are in the buffer
+    TaskHandle_t onReady = NULL;        // woken when a cover is ready
+
+    // Statistics
+    LatencyStats decodeTime{"Album art fetch+decode"};
+    uint32_t bytesFetched = 0;
+    uint32_t decoded = 0;
+    uint32_t failed = 0;
+
+    // TJPGD input: read (or skip, when buff is NULL) the next nbyte of the body
+    static size_t jpegInput(JDEC* jd, uint8_t* buff, size_t nbyte) {
+        DecodeContext* ctx = (DecodeContext*)jd->device;
+        if (ctx->remaining >= 0 && (size_t)ctx->remaining < nbyte) {
+            nbyte = ctx->remaining;
+        }
+        size_t done = 0;
+        uint8_t scratch[64];
+        while (done < nbyte) {
+            size_t want = nbyte - done;
+            uint8_t* dst = buff ? buff + done : scratch;
+            if (!buff && want > sizeof(scratch)) {
+                want = sizeof(scratch);
+            }
+            size_t got = ctx->in->readBytes(dst, want);     // honours the stream timeout
+            if (got == 0) {
+                break;
+            }
+            done += got;
+        }
+        if (ctx->remaining >= 0) {
+            ctx->remaining -= done;
+        }
+        ctx->bytes += done;
+        return done;
+    }
+
+    // TJPGD output: one decoded block; convert to swapped RGB565 and crop into place
+    static int jpegOutput(JDEC* jd, void* bitmap, JRECT* rect) {
+        DecodeContext* ctx = (DecodeContext*)jd->device;
+#if JD_FORMAT == 1
+        const uint16_t* src = (const uint16_t*)bitmap;
+#else
+        const uint8_t* src = (const uint8_t*)bitmap;
+#endif
+        for (int y = rect->top; y <= rect->bottom; y++) {
+            int dy = y - ctx->offsetY;
+            for (int x = rect->left; x <= rect->right; x++) {
+#if JD_FORMAT == 1
+                uint16_t color = *src++;
+#else
+                uint16_t color = ((src[0] & 0xF8) << 8) | ((src[1] & 0xFC) << 3) | (src[2] >> 3);
+                src += 3;
+#endif
+                int dx = x - ctx->offsetX;
+                if (dx >= 0 && dx < ART_SIZE && dy >= 0 && dy < ART_SIZE) {
+                    ctx->out[dy * ART_SIZE + dx] = (color >> 8) | (color << 8);
+                }
+            }
+        }
+        return 1;
+    }
+
+    bool fetchAndDecode(const char* url) {
+        if (ESP.getMaxAllocHeap() < MIN_HEAP) {
+            Serial.println("Album art skipped: not enough free heap");
+            return false;
+        }
+
+        // Covers are public CDN files: no token, and not api.spotify.com
+        WiFiClientSecure client;
+        client.setInsecure();
+        client.setTimeout(5);
+        HTTPClient http;
+        http.useHTTP10(true);       // plain body, no chunk framing in front of TJPGD
+        if (!http.begin(client, url)) {
+            return false;
+        }
+        int code = http.GET();
+        if (code != 200) {
+            Serial.printf("Album art download failed: %d\n", code);
+            http.end();
+            return false;
+        }
+
+        unsigned long start = micros();
+        DecodeContext ctx = { http.getStreamPtr(), http.getSize(), pixels, 0, 0, 0 };
+        void* pool = malloc(WORK_POOL_SIZE);
+        JRESULT res = JDR_MEM1;
+        if (pool) {
+            JDEC jd;
+            res = jd_prepare(&jd, jpegInput, pool, WORK_POOL_SIZE, &ctx);
+            if (res == JDR_OK) {
+                uint8_t scale = 0;
+                while (scale < 3 && (jd.width >> (scale + 1)) >= ART_SIZE &&
+                       (jd.height >> (scale + 1)) >= ART_SIZE) {
+                    scale++;
+                }
+                uint16_t w = jd.width >> scale;
+                uint16_t h = jd.height >> scale;
+                ctx.offsetX = w > ART_SIZE ? (w - ART_SIZE) / 2 : 0;
+                ctx.offsetY = h > ART_SIZE ? (h - ART_SIZE) / 2 : 0;
+                if (w < ART_SIZE || h < ART_SIZE) {
+                    memset(pixels, 0, PIXEL_BYTES);     // small cover: black border
+                }
+                res = jd_decomp(&jd, jpegOutput, scale);
+            }
+            free(pool);
+        }
+        decodeTime.record(micros() - start);
+        bytesFetched += ctx.bytes;
+        http.end();
+
+        if (res != JDR_OK) {
+            Serial.printf("Album art decode failed: %d\n", res);
+            return false;
+        }
+        return true;
+    }
+
+    void run() {
+        ArtJob job;
+        for (;;) {
+            if (xQueueReceive(jobs, &job, portMAX_DELAY) != pdTRUE) {
+                continue;
+            }
+            bool ok = cache.load(job.albumId, (uint8_t*)pixels, PIXEL_BYTES);
+            if (!ok) {
+                ok = fetchAndDecode(job.url);
+                if (ok) {
+                    decoded++;
+                    cache.store(job.albumId, (const uint8_t*)pixels, PIXEL_BYTES);
+                } else {
+                    failed++;
+                }
+            }
+            if (ok) {
+                readyGen = job.generation;
+                if (onReady != NULL) {
+                    xTaskNotifyGive(onReady);
+                }
+            }
+            printStats();
+        }
+    }
+
+    static void taskEntry(void* param) {
+        ((AlbumArt*)param)->run();
+    }
+
+public:
+    bool begin() {
+        pixels = (uint16_t*)malloc(PIXEL_BYTES);
+        jobs = xQueueCreate(1, sizeof(ArtJob));
+        if (!pixels || !jobs) {
+            Serial.println("Album art disabled: allocation failed");
+            return false;
+        }
+        memset(&dsc, 0, sizeof(dsc));
+        dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+        dsc.header.cf = LV_COLOR_FORMAT_RGB565_SWAPPED;
+        dsc.header.w = ART_SIZE;
+        dsc.header.h = ART_SIZE;
+        dsc.header.stride = ART_SIZE * sizeof(uint16_t);
+        dsc.data_size = PIXEL_BYTES;
+        dsc.data = (const uint8_t*)pixels;
+
+        cache.begin();
+        // Priority 1 on core 1: below input and rendering, away from the network lanes
+        xTaskCreatePinnedToCore(taskEntry, "AlbumArt", 8192, this, 1, NULL, 1);
+        return true;
+    }
+
+    // Task to notify when a cover is ready for takeReady()
+    void setOnReady(TaskHandle_t task) { onReady = task; }
+
+    // UI: a new album is playing. The caller must already have stopped
+    // displaying the buffer (placeholder shown).
+    void request(const String& albumId, const String& url) {
+        if (!jobs || albumId.length() == 0 || url.length() == 0) {
+            return;
+        }
+        ArtJob job;
+        strlcpy(job.albumId, albumId.c_str(), sizeof(job.albumId));
+        strlcpy(job.url, url.c_str(), sizeof(job.url));
+        job.generation = ++wanted;
+        xQueueOverwrite(jobs, &job);    // only the newest album matters
+    }
+
+    // UI: true once the cover for the latest request is in the buffer
+    bool takeReady() {
+        if (wanted == 0 || readyGen != wanted) {
+            return false;
+        }
+        readyGen = 0;
+        return true;
+    }
+
+    const lv_image_dsc_t* get_image() { return &dsc; }
+
+    void printStats() {
+        Serial.printf("Album art: %lu decoded, %lu failed, %lu KB fetched\n",
+                      (unsigned long)decoded, (unsigned long)failed,
+                      (unsigned long)(bytesFetched / 1024));
+        decodeTime.print();
+        cache.printStats();
+    }
+};
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef ART_CACHE_H
+#define ART_CACHE_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+// Flash-backed LRU of decoded album covers, keyed by Spotify album id
+// Each entry is one raw RGB565 file (panel byte order) under /art, so a
+// repeated album costs a flash read instead of a download and a JPEG decode.
+// The recency order is kept in /art/index (one id per line, most recent first).
+// Only the album art task touches it, so there is no locking.
+
+class ArtCache {
+private:
+    static const size_t MAX_ENTRIES = 12;       // 12 x 45 KB fits the 896 KB data partition
+
+    String order[MAX_ENTRIES];                  // most recently used first
+    size_t count = 0;
+    bool mounted = false;
+
+    // Statistics
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+
+    static String pathFor(const String& albumId) {
+        return "/art/" + albumId + ".565s";
+    }
+
+    // Covers saved by older firmware in unswapped byte order
+    void removeStale() {
+        File dir = LittleFS.open("/art");
+        if (!dir) {
+            return;
+        }
+        String stale[MAX_ENTRIES];
+        size_t found = 0;
+        for (File file = dir.openNextFile(); file && found < MAX_ENTRIES; file = dir.openNextFile()) {
+            String name = file.name();
+            if (name.endsWith(".565")) {
+                stale[found++] = "/art/" + name.substring(name.lastIndexOf('/') + 1);
+            }
+            file.close();
+        }
+        dir.close();
+        for (size_t i = 0; i < found; i++) {
+            LittleFS.remove(stale[i]);
+        }
+    }
+
+    void saveIndex() {
+        File index = LittleFS.open("/art/index", "w");
+        if (!index) {
+            return;
+        }
+        for (size_t i = 0; i < count; i++) {
+            index.println(order[i]);
+        }
+        index.close();
+    }
+
+    // Move (or insert) an id to the front, evicting the oldest entry if full
+    void touch(const String& albumId) {
+        size_t at = count;
+        for (size_t i = 0; i < count; i++) {
+            if (order[i] == albumId) {
+                at = i;
+                break;
+            }
+        }
+        if (at == count) {
+            if (count == MAX_ENTRIES) {
+                LittleFS.remove(pathFor(order[count - 1]));
+                evictions++;
+                at = count - 1;
+            } else {
+                at = count++;
+            }
+        }
+        for (size_t i = at; i > 0; i--) {
+            order[i] = order[i - 1];
+        }
+        order[0] = albumId;
+        saveIndex();
+    }
+
+public:
+    bool begin() {
+        mounted = LittleFS.begin(true);     // format on first use
+        if (!mounted) {
+            Serial.println("Album art cache: LittleFS mount failed, caching disabled");
+            return false;
+        }
+        if (!LittleFS.exists("/art")) {
+            LittleFS.mkdir("/art");
+        }
+        removeStale();
+
+        File index = LittleFS.open("/art/index", "r");
+        while (index && index.available() && count < MAX_ENTRIES) {
+            String albumId = index.readStringUntil('\n');
+            albumId.trim();
+            if (albumId.length() > 0 && LittleFS.exists(pathFor(albumId))) {
+                order[count++] = albumId;
+            }
+        }
+        if (index) {
+            index.close();
+        }
+        Serial.printf("Album art cache: %u covers on flash\n", (unsigned)count);
+        return true;
+    }
+
+    // Read a cached cover into buf; false on a miss
+    bool load(const String& albumId, uint8_t* buf, size_t size) {
+        if (!mounted || albumId.length() == 0) {
+            return false;
+        }
+        File file = LittleFS.open(pathFor(albumId), "r");
+        bool ok = file && file.size() == size && file.read(buf, size) == size;
+        if (file) {
+            file.close();
+        }
+        if (!ok) {
+            misses++;
+            return false;
+        }
+        hits++;
+        touch(albumId);
+        return true;
+    }
+
+    void store(const String& albumId, const uint8_t* buf, size_t size) {
+        if (!mounted || albumId.length() == 0) {
+            return;
+        }
+        File file = LittleFS.open(pathFor(albumId), "w");
+        if (!file) {
+            return;
+        }
+        bool ok = file.write(buf, size) == size;
+        file.close();
+        if (!ok) {
+            LittleFS.remove(pathFor(albumId));      // full or failing flash: don't keep a torn file
+            return;
+        }
+        touch(albumId);
+    }
+
+    float get_hit_rate() {
+        uint32_t total = hits + misses;
+        return total ? (float)hits / total : 0.0f;
+    }
+
+    void printStats() {
+        Serial.printf("Album art cache: %lu hits, %lu misses (%.0f%% hit rate), %u/%u covers, %lu evictions\n",
+                      (unsigned long)hits, (unsigned long)misses, get_hit_rate() * 100.0f,
+                      (unsigned)count, (unsigned)MAX_ENTRIES, (unsigned long)evictions);
+    }
+};
+
+#endif
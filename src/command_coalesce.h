@@ -0,0 +1,68 @@
+#ifndef COMMAND_COALESCE_H
+#define COMMAND_COALESCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Commands and the merge rules applied when the command lane drains a burst
+// Plain C++ with no Arduino or FreeRTOS dependency, so the rules are unit
+// tested on the host (pio test -e native).
+
+enum CommandType : uint8_t {
+    CMD_PLAY,
+    CMD_PAUSE,
+    CMD_NEXT,
+    CMD_PREV,
+    CMD_TOGGLE_SHUFFLE,
+    CMD_TOGGLE_LIKE,
+#ifdef LANE_BENCHMARK
+    CMD_BENCH_PROBE      // harmless read injected by the lane benchmark
+#endif
+};
+
+struct Command {
+    CommandType type;
+    int16_t arg;
+    uint32_t timestampUs;  // micros() when the input was read
+};
+
+// Merge adjacent commands in place, keeping order. Returns the new count.
+//  - Play/Pause runs collapse to the last press (opposing pairs cancel)
+//  - Repeated toggles cancel in pairs
+//  - Next/Prev are never merged: N presses stay N skips
+// Merged commands keep the earliest timestamp so latency covers the first press.
+// `cancelled`, if given, gets a bit (1 << CommandType) for every type whose
+// commands all cancelled out, so nothing of that type will be sent.
+inline size_t coalesceCommands(Command* cmds, size_t count, uint32_t* cancelled = nullptr) {
+    uint32_t gone = 0;
+    size_t out = 0;
+    for (size_t i = 0; i < count; i++) {
+        Command cmd = cmds[i];
+        if (out > 0) {
+            Command& last = cmds[out - 1];
+            bool lastIsPlayback = (last.type == CMD_PLAY || last.type == CMD_PAUSE);
+            bool cmdIsPlayback = (cmd.type == CMD_PLAY || cmd.type == CMD_PAUSE);
+
+            if (lastIsPlayback && cmdIsPlayback) {
+                last.type = cmd.type;
+                continue;
+            }
+            if (last.type == cmd.type &&
+                (cmd.type == CMD_TOGGLE_SHUFFLE || cmd.type == CMD_TOGGLE_LIKE)) {
+                out--;
+                gone |= (1UL << cmd.type);
+                continue;
+            }
+        }
+        cmds[out++] = cmd;
+    }
+    if (cancelled) {
+        for (size_t i = 0; i < out; i++) {
+            gone &= ~(1UL << cmds[i].type);
+        }
+        *cancelled = gone;
+    }
+    return out;
+}
+
+#endif
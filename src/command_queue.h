@@ -0,0 +1,69 @@
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <Arduino.h>
+#include "command_coalesce.h"
+
+// Ordered, bounded command queue between the UI loop and the Spotify task
+// Every press becomes one timestamped command; nothing is collapsed into a flag.
+// Volume is not queued: it is an absolute target kept in VolumeControl.
+
+class CommandQueue {
+private:
+    QueueHandle_t queue = NULL;
+    size_t capacity = 0;
+
+    // Statistics
+    uint32_t enqueued = 0;
+    uint32_t dropped = 0;
+    uint32_t merged = 0;
+    size_t maxDepth = 0;
+
+public:
+    bool begin(size_t depth) {
+        capacity = depth;
+        queue = xQueueCreate(depth, sizeof(Command));
+        return queue != NULL;
+    }
+
+    // Non-blocking; a full queue counts as a drop instead of stalling the UI loop
+    bool push(CommandType type, int16_t arg = 0) {
+        Command cmd = { type, arg, (uint32_t)micros() };
+        if (xQueueSend(queue, &cmd, 0) != pdTRUE) {
+            dropped++;
+            return false;
+        }
+        enqueued++;
+        size_t depth = uxQueueMessagesWaiting(queue);
+        if (depth > maxDepth) {
+            maxDepth = depth;
+        }
+        return true;
+    }
+
+    bool pending() {
+        return queue != NULL && uxQueueMessagesWaiting(queue) > 0;
+    }
+
+    // Take everything currently queued and merge it. Returns the command count;
+    // `cancelled` gets the types that cancelled out (see coalesceCommands()).
+    size_t drain(Command* out, size_t maxCount, uint32_t* cancelled = nullptr) {
+        size_t count = 0;
+        while (count < maxCount && xQueueReceive(queue, &out[count], 0) == pdTRUE) {
+            count++;
+        }
+        size_t result = coalesceCommands(out, count, cancelled);
+        merged += count - result;
+        return result;
+    }
+
+    size_t get_capacity() { return capacity; }
+
+    void printStats() {
+        Serial.printf("Command queue: %lu enqueued, %lu merged, %lu dropped, max depth %u/%u\n",
+                      (unsigned long)enqueued, (unsigned long)merged, (unsigned long)dropped,
+                      (unsigned)maxDepth, (unsigned)capacity);
+    }
+};
+
+#endif
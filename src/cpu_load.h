@@ -0,0 +1,77 @@
+#ifndef CPU_LOAD_H
+#define CPU_LOAD_H
+
+#include <Arduino.h>
+#include <esp_freertos_hooks.h>
+#include <esp_timer.h>
+
+// Per-core idle time between two reports. Shows whether the render task
+// really sleeps when nothing on screen changes. Works on the stock core, which
+// is built without FreeRTOS run time stats:
+//  - an idle hook runs each time a core's idle task loops, just before the
+//    core waits for an interrupt; the time since the previous call counts as
+//    idle (esp_timer, us)
+//  - a tick hook that finds another task running marks the core busy, so
+//    the next gap is not counted. Only a task switch that both starts and
+//    ends between two ticks still counts as idle; that is well under 1 ms.
+
+class CpuLoad {
+private:
+    static volatile uint32_t idleUs[portNUM_PROCESSORS];
+    static volatile uint32_t idleSince[portNUM_PROCESSORS];
+    static volatile bool idleRunning[portNUM_PROCESSORS];
+
+    uint32_t lastIdle[portNUM_PROCESSORS] = {};
+    uint32_t lastAt = 0;
+
+    static bool IRAM_ATTR onIdle() {
+        int core = xPortGetCoreID();
+        uint32_t now = (uint32_t)esp_timer_get_time();
+        if (idleRunning[core]) {
+            idleUs[core] += now - idleSince[core];
+        }
+        idleSince[core] = now;
+        idleRunning[core] = true;
+        return true;        // let the core wait for an interrupt
+    }
+
+    static void IRAM_ATTR onTick() {
+        int core = xPortGetCoreID();
+        if (xTaskGetCurrentTaskHandleForCPU(core) != xTaskGetIdleTaskHandleForCPU(core)) {
+            idleRunning[core] = false;
+        }
+    }
+
+public:
+    void begin() {
+        for (int core = 0; core < portNUM_PROCESSORS; core++) {
+            esp_register_freertos_idle_hook_for_cpu(onIdle, core);
+            esp_register_freertos_tick_hook_for_cpu(onTick, core);
+        }
+        lastAt = (uint32_t)esp_timer_get_time();
+    }
+
+    void printStats() {
+        if (lastAt == 0) {
+            return;     // begin() not called
+        }
+        uint32_t now = (uint32_t)esp_timer_get_time();
+        uint32_t elapsed = now - lastAt;
+        if (elapsed > 0) {
+            Serial.print("CPU idle:");
+            for (int core = 0; core < portNUM_PROCESSORS; core++) {
+                uint32_t idle = idleUs[core];
+                Serial.printf(" core %d %.1f%%", core, min(idle - lastIdle[core], elapsed) * 100.0f / elapsed);
+                lastIdle[core] = idle;
+            }
+            Serial.println();
+        }
+        lastAt = now;
+    }
+};
+
+volatile uint32_t CpuLoad::idleUs[portNUM_PROCESSORS] = {};
+volatile uint32_t CpuLoad::idleSince[portNUM_PROCESSORS] = {};
+volatile bool CpuLoad::idleRunning[portNUM_PROCESSORS] = {};
+
+#endif
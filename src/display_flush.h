@@ -0,0 +1,247 @@
+#ifndef DISPLAY_FLUSH_H
+#define DISPLAY_FLUSH_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <TFT_eSPI.h>
+#include "latency_stats.h"
+
+// LVGL flush path to the TFT
+// Two DMA-capable strip buffers: while one strip is shifted out over SPI DMA,
+// LVGL renders the next one into the other buffer. TFT_eSPI exposes no
+// transfer-complete callback, so a flush queues its transfer and reports
+// ready straight away; the next flush waits in pushImageDMA() until the
+// previous transfer has finished, which is exactly when that buffer is free
+// again. The SPI transaction stays open between flushes (the panel is the
+// only device on the bus) because endWrite() would wait for the transfer.
+// Build with -DDISPLAY_SYNC_FLUSH for the old single-buffer blocking flush,
+// to compare frame time and throughput.
+// LVGL renders straight into the panel's byte order (RGB565_SWAPPED), so the
+// strips go out as they are, with no per-pixel swap on the CPU.
+// With two draw units both cores draw into the same strip. LVGL only hands
+// a strip to flush() once every draw task on it has finished, and only starts
+// drawing into a buffer after the previous flush() has waited out that
+// buffer's transfer, so no draw unit ever writes a strip while it is sent.
+
+class DisplayFlush {
+private:
+    TFT_eSPI& tft;
+    size_t bufPixels;
+    uint16_t* bufs[2] = {nullptr, nullptr};
+
+    // Statistics
+    LatencyStats renderTime{"Frame render+flush"};
+    LatencyStats flushTime{"Flush callback"};       // CPU time inside flush()
+    uint32_t renderStartUs = 0;
+    uint32_t frames = 0;
+    uint64_t pixels = 0;
+    uint64_t renderUsTotal = 0;
+    uint32_t frameFlushes = 0;          // areas sent in the current frame
+    uint32_t flushes = 0;
+    uint32_t maxFrameFlushes = 0;
+    uint64_t reportedPixels = 0;
+    unsigned long reportedAt = 0;
+#ifdef DRAW_BENCHMARK
+    bool discard = false;       // draw only, send nothing
+#endif
+
+    static void onRender(lv_event_t* e) {
+        DisplayFlush* self = (DisplayFlush*)lv_event_get_user_data(e);
+        if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+            self->renderStartUs = micros();
+            self->frameFlushes = 0;
+        } else {
+            uint32_t us = micros() - self->renderStartUs;
+            self->renderTime.record(us);
+            self->renderUsTotal += us;
+            self->frames++;
+            self->flushes += self->frameFlushes;
+            if (self->frameFlushes > self->maxFrameFlushes) {
+                self->maxFrameFlushes = self->frameFlushes;
+            }
+        }
+    }
+
+    static void onFlush(lv_display_t* disp, const lv_area_t* area, uint8_t* pixelmap) {
+        ((DisplayFlush*)lv_display_get_user_data(disp))->flush(disp, area, pixelmap);
+    }
+
+    void flush(lv_display_t* disp, const lv_area_t* area, uint8_t* pixelmap) {
+#ifdef DRAW_BENCHMARK
+        if (discard) {
+            lv_display_flush_ready(disp);
+            return;
+        }
+#endif
+        uint32_t start = micros();
+        uint32_t w = lv_area_get_width(area);
+        uint32_t h = lv_area_get_height(area);
+
+#ifdef DISPLAY_SYNC_FLUSH
+        tft.startWrite();
+        tft.setAddrWindow(area->x1, area->y1, w, h);
+        tft.pushColors((uint16_t*)pixelmap, w * h, false);
+        tft.endWrite();
+#else
+        // Waits for the previous strip, then queues this one and returns
+        tft.pushImageDMA(area->x1, area->y1, w, h, (uint16_t*)pixelmap);
+#endif
+        lv_display_flush_ready(disp);
+
+        flushTime.record(micros() - start);
+        pixels += w * h;
+        frameFlushes++;
+    }
+
+public:
+    DisplayFlush(TFT_eSPI& display, size_t stripPixels)
+        : tft(display), bufPixels(stripPixels) {}
+
+    // Allocate the strip buffers from DMA-capable internal RAM. Call early,
+    // before Wi-Fi and TLS fragment the heap.
+    bool allocate() {
+#ifdef DISPLAY_SYNC_FLUSH
+        const int buffers = 1;
+#else
+        const int buffers = 2;
+#endif
+        for (int i = 0; i < buffers; i++) {
+            bufs[i] = (uint16_t*)heap_caps_malloc(bufPixels * sizeof(uint16_t), MALLOC_CAP_DMA);
+            if (bufs[i] == nullptr) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t get_buffer_bytes() {
+        return bufPixels * sizeof(uint16_t) * (bufs[1] ? 2 : 1);
+    }
+
+    // Hook the buffers and flush path into an LVGL display (after tft.begin())
+    void begin(lv_display_t* disp) {
+#ifndef DISPLAY_SYNC_FLUSH
+        tft.initDMA();
+        tft.setSwapBytes(false);    // already in panel order
+        tft.startWrite();
+#endif
+        lv_display_set_user_data(disp, this);
+        lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565_SWAPPED);
+        lv_display_set_buffers(disp, bufs[0], bufs[1], bufPixels * sizeof(uint16_t),
+                               LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(disp, onFlush);
+        lv_display_add_event_cb(disp, onRender, LV_EVENT_RENDER_START, this);
+        lv_display_add_event_cb(disp, onRender, LV_EVENT_RENDER_READY, this);
+    }
+
+#ifdef FLUSH_BENCHMARK
+    // Cost of sending one strip with the CPU byte swap and pre-swapped, in
+    // us per 1000 pixels. Call after begin(), before LVGL draws anything.
+    void benchmark() {
+        static const int ROUNDS = 20;
+        uint32_t w = tft.width();
+        uint32_t h = bufPixels / w;
+        uint16_t* strip = bufs[0];
+        for (size_t i = 0; i < w * h; i++) {
+            strip[i] = (uint16_t)(i * 40503u);
+        }
+
+        for (int swap = 1; swap >= 0; swap--) {
+            uint32_t start;
+#ifndef DISPLAY_SYNC_FLUSH
+            tft.setSwapBytes(swap);
+            start = micros();
+            for (int r = 0; r < ROUNDS; r++) {
+                tft.pushImageDMA(0, 0, w, h, strip);
+            }
+            tft.dmaWait();
+            uint32_t dmaUs = micros() - start;
+            tft.setSwapBytes(false);
+#else
+            tft.startWrite();
+#endif
+            start = micros();
+            for (int r = 0; r < ROUNDS; r++) {
+                tft.setAddrWindow(0, 0, w, h);
+                tft.pushColors(strip, w * h, swap);
+            }
+            uint32_t syncUs = micros() - start;
+#ifdef DISPLAY_SYNC_FLUSH
+            tft.endWrite();
+#endif
+            float pixelsK = ROUNDS * w * h / 1000.0f;
+            Serial.printf("Flush benchmark (%s): blocking %.1f us/1000 px", swap ? "CPU swap" : "pre-swapped",
+                          syncUs / pixelsK);
+#ifndef DISPLAY_SYNC_FLUSH
+            Serial.printf(", DMA %.1f us/1000 px", dmaUs / pixelsK);
+#endif
+            Serial.println();
+        }
+    }
+#endif
+
+#ifdef DRAW_BENCHMARK
+    // Full-screen and partial (`partial` only) redraw time with the draw
+    // units this build has, drawing only and drawn + sent. Call once the UI
+    // is built, before the render task starts.
+    void benchmarkRedraw(lv_obj_t* partial) {
+        static const int ROUNDS = 20;
+        lv_display_t* disp = lv_display_get_default();
+        lv_obj_t* targets[2] = {lv_screen_active(), partial};
+
+        for (int send = 0; send <= 1; send++) {
+            discard = !send;
+            for (int t = 0; t < 2; t++) {
+                LatencyStats redraw{"Redraw"};
+                for (int r = 0; r < ROUNDS; r++) {
+                    lv_obj_invalidate(targets[t]);
+                    uint32_t start = micros();
+                    lv_refr_now(disp);
+#ifndef DISPLAY_SYNC_FLUSH
+                    if (send) {
+                        tft.dmaWait();      // include the last strip
+                    }
+#endif
+                    redraw.record(micros() - start);
+                }
+                Serial.printf("Draw benchmark (%d draw units, %s): %s %ldx%ld avg %.2f ms, max %.2f ms\n",
+                              (int)LV_DRAW_SW_DRAW_UNIT_CNT, send ? "drawn+sent" : "draw only",
+                              t == 0 ? "full screen" : "partial",
+                              (long)lv_obj_get_width(targets[t]), (long)lv_obj_get_height(targets[t]),
+                              redraw.get_avg_us() / 1000.0f, redraw.get_max_us() / 1000.0f);
+            }
+        }
+        discard = false;
+    }
+#endif
+
+    uint32_t get_frames() { return frames; }
+
+    // Pixels per second while frames were being rendered and sent
+    uint32_t get_pixels_per_second() {
+        return renderUsTotal ? (uint32_t)(pixels * 1000000ULL / renderUsTotal) : 0;
+    }
+
+    void printStats() {
+#ifdef DISPLAY_SYNC_FLUSH
+        const char* mode = "sync";
+#else
+        const char* mode = "DMA x2";
+#endif
+        // Average panel traffic since the last report
+        unsigned long now = millis();
+        uint32_t sentPerSecond = now != reportedAt
+            ? (uint32_t)((pixels - reportedPixels) * 1000ULL / (now - reportedAt)) : 0;
+        reportedPixels = pixels;
+        reportedAt = now;
+
+        Serial.printf("Display (%s): %lu frames, %.1f areas/frame (max %lu), %lu px/s while rendering, %lu px/s sent\n",
+                      mode, (unsigned long)frames, frames ? (float)flushes / frames : 0.0f,
+                      (unsigned long)maxFrameFlushes, (unsigned long)get_pixels_per_second(),
+                      (unsigned long)sentPerSecond);
+        renderTime.print();
+        flushTime.print();
+    }
+};
+
+#endif
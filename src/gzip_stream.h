@@ -0,0 +1,261 @@
+#ifndef GZIP_STREAM_H
+#define GZIP_STREAM_H
+
+#include <Arduino.h>
+#if __has_include("esp32/rom/miniz.h")
+#include "esp32/rom/miniz.h"
+#else
+#include "rom/miniz.h"
+#endif
+#include "esp_rom_crc.h"
+
+// Streaming gzip decoding with the tinfl inflater in the ESP32 ROM
+// GzipInflater owns the fixed memory budget: the tinfl state (~11 KB) and
+// the 32 KB window deflate requires (TINFL_LZ_DICT_SIZE), allocated once.
+// Both sessions share one inflater; a request that cannot take it simply
+// goes out without Accept-Encoding, so commands never wait on a poll.
+// GzipStream inflates a gzip body read from another Stream as the JSON
+// parser pulls bytes, so neither the compressed nor the inflated body is
+// ever held in memory as a whole. The CRC32 and length in the gzip trailer
+// are checked once the deflate stream ends.
+
+class GzipInflater {
+private:
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    bool busy = false;
+
+public:
+    static const size_t INPUT_SIZE = 256;
+
+    tinfl_decompressor* state = nullptr;
+    uint8_t* window = nullptr;
+    uint8_t input[INPUT_SIZE];
+
+    bool begin() {
+        state = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+        window = (uint8_t*)malloc(TINFL_LZ_DICT_SIZE);
+        if (!state || !window) {
+            free(state);
+            free(window);
+            state = nullptr;
+            window = nullptr;
+            Serial.println("gzip disabled: could not allocate the inflate window");
+            return false;
+        }
+        return true;
+    }
+
+    size_t get_budget() {
+        return sizeof(tinfl_decompressor) + TINFL_LZ_DICT_SIZE + INPUT_SIZE;
+    }
+
+    // Non-blocking: false if not allocated or in use by the other lane
+    bool tryAcquire() {
+        if (!state) {
+            return false;
+        }
+        portENTER_CRITICAL(&lock);
+        bool acquired = !busy;
+        busy = true;
+        portEXIT_CRITICAL(&lock);
+        return acquired;
+    }
+
+    void release() {
+        portENTER_CRITICAL(&lock);
+        busy = false;
+        portEXIT_CRITICAL(&lock);
+    }
+};
+
+class GzipStream : public Stream {
+private:
+    Stream& source;
+    GzipInflater& inflater;
+    tinfl_status status = TINFL_STATUS_NEEDS_MORE_INPUT;
+    bool headerDone = false;
+    bool inputEnded = false;
+    bool finished = false;
+    bool failed = false;
+
+    size_t inPos = 0;
+    size_t inLen = 0;
+    size_t windowPos = 0;       // where tinfl writes next
+    size_t head = 0;            // inflated bytes not yet handed out: window[head, tail)
+    size_t tail = 0;
+    uint32_t bytesOut = 0;
+    uint32_t crc = 0;
+
+    int nextInput() {
+        if (inPos == inLen) {
+            inLen = source.readBytes((char*)inflater.input, GzipInflater::INPUT_SIZE);
+            inPos = 0;
+            if (inLen == 0) {
+                return -1;
+            }
+        }
+        return inflater.input[inPos++];
+    }
+
+    // RFC 1952 member header: magic, method, flags, then optional fields
+    bool readHeader() {
+        uint8_t fixed[10];
+        for (size_t i = 0; i < sizeof(fixed); i++) {
+            int c = nextInput();
+            if (c < 0) {
+                return false;
+            }
+            fixed[i] = c;
+        }
+        if (fixed[0] != 0x1F || fixed[1] != 0x8B || fixed[2] != 8) {
+            return false;
+        }
+        uint8_t flags = fixed[3];
+        if (flags & 0x04) {             // FEXTRA
+            int lo = nextInput();
+            int hi = nextInput();
+            if (lo < 0 || hi < 0) {
+                return false;
+            }
+            for (int n = lo | (hi << 8); n > 0; n--) {
+                if (nextInput() < 0) {
+                    return false;
+                }
+            }
+        }
+        for (uint8_t field = 0x08; field <= 0x10; field <<= 1) {   // FNAME, FCOMMENT
+            if (flags & field) {
+                int c;
+                while ((c = nextInput()) > 0) {}
+                if (c < 0) {
+                    return false;
+                }
+            }
+        }
+        if (flags & 0x02) {             // FHCRC
+            if (nextInput() < 0 || nextInput() < 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // tinfl refills its bit buffer ahead of need, so when the final block
+    // ends it may already hold the first trailer bytes (after the unused
+    // bits of the last deflate byte). Those come before the unread input.
+    int nextTrailerByte() {
+        tinfl_decompressor* r = inflater.state;
+        r->m_bit_buf >>= r->m_num_bits & 7;
+        r->m_num_bits &= ~7u;
+        if (r->m_num_bits > 0) {
+            int c = r->m_bit_buf & 0xFF;
+            r->m_bit_buf >>= 8;
+            r->m_num_bits -= 8;
+            return c;
+        }
+        return nextInput();
+    }
+
+    // Trailer: CRC32 and length of the inflated data, little-endian
+    bool checkTrailer() {
+        uint32_t fields[2] = { 0, 0 };
+        for (int i = 0; i < 8; i++) {
+            int c = nextTrailerByte();
+            if (c < 0) {
+                return false;
+            }
+            fields[i / 4] |= (uint32_t)c << (8 * (i % 4));
+        }
+        return fields[0] == crc && fields[1] == bytesOut;
+    }
+
+    bool fill() {
+        if (failed || finished) {
+            return false;
+        }
+        if (!headerDone) {
+            tinfl_init(inflater.state);
+            headerDone = true;
+            if (!readHeader()) {
+                failed = true;
+                return false;
+            }
+        }
+        while (status != TINFL_STATUS_DONE) {
+            if (inPos == inLen && !inputEnded) {
+                inLen = source.readBytes((char*)inflater.input, GzipInflater::INPUT_SIZE);
+                inPos = 0;
+                inputEnded = (inLen == 0);
+            }
+            size_t inBytes = inLen - inPos;
+            size_t outBytes = TINFL_LZ_DICT_SIZE - windowPos;
+            status = tinfl_decompress(inflater.state, inflater.input + inPos, &inBytes,
+                                      inflater.window, inflater.window + windowPos, &outBytes,
+                                      inputEnded ? 0 : TINFL_FLAG_HAS_MORE_INPUT);
+            inPos += inBytes;
+            if (status < 0 || (status == TINFL_STATUS_NEEDS_MORE_INPUT && inputEnded)) {
+                failed = true;
+                return false;
+            }
+            if (outBytes > 0) {
+                head = windowPos;
+                tail = windowPos + outBytes;
+                windowPos = (windowPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+                bytesOut += outBytes;
+                crc = esp_rom_crc32_le(crc, inflater.window + head, outBytes);
+                return true;
+            }
+        }
+        finished = true;
+        if (!checkTrailer()) {
+            failed = true;
+        }
+        return false;
+    }
+
+public:
+    GzipStream(Stream& in, GzipInflater& state) : source(in), inflater(state) {}
+
+    int available() override {
+        return tail - head;
+    }
+
+    int read() override {
+        if (head == tail && !fill()) {
+            return -1;
+        }
+        return inflater.window[head++];
+    }
+
+    int peek() override {
+        if (head == tail && !fill()) {
+            return -1;
+        }
+        return inflater.window[head];
+    }
+
+    size_t readBytes(char* buffer, size_t length) override {
+        size_t done = 0;
+        while (done < length) {
+            if (head == tail && !fill()) {
+                break;
+            }
+            size_t n = tail - head;
+            if (n > length - done) {
+                n = length - done;
+            }
+            memcpy(buffer + done, inflater.window + head, n);
+            head += n;
+            done += n;
+        }
+        return done;
+    }
+
+    size_t write(uint8_t) override { return 0; }
+    void flush() override {}
+
+    bool has_failed() { return failed; }
+    uint32_t get_bytes_out() { return bytesOut; }
+};
+
+#endif
@@ -0,0 +1,499 @@
+#ifndef HTTP2_CONNECTION_H
+#define HTTP2_CONNECTION_H
+
+#ifdef SPOTIFY_USE_HTTP2
+
+#include <Arduino.h>
+#if !__has_include("nghttp2/nghttp2.h")
+#error "SPOTIFY_USE_HTTP2 needs the nghttp2 component of ESP-IDF"
+#endif
+#include "nghttp2/nghttp2.h"
+#include "tls_session.h"
+
+// One HTTP/2 connection to the Spotify API, shared by both network lanes
+// Each request is a stream, so a poll, a liked-check and a command can all be
+// in flight on the same TLS connection. HPACK turns the repeated headers into
+// table indexes; nghttp2 never indexes Authorization (RFC 7541 7.1.3), so the
+// token is still sent each time, Huffman-coded.
+// Whichever lane is waiting drives the I/O for every stream (under the mutex,
+// one read at a time), so there is no extra task.
+// Window updates are manual: a stream's window is its ring buffer size and is
+// only reopened as the parser consumes bytes, so a slow reader never makes
+// another stream's data pile up in RAM.
+
+class Http2Connection {
+public:
+    static const size_t MAX_STREAMS = 3;
+    static const size_t STREAM_WINDOW = 4096;       // power of two, per-stream ring buffer
+
+private:
+    static const size_t READ_CHUNK = 512;
+    static const size_t CONSUME_BATCH = 1024;       // bytes read before a WINDOW_UPDATE
+
+    struct StreamSlot {
+        int32_t id;                     // 0 = free
+        int status;                     // :status of the response
+        bool headersDone;
+        bool closed;
+        uint32_t errorCode;             // RST_STREAM/GOAWAY code, 0 = clean end
+        bool gzip;
+        long retryAfter;
+        const String* body;
+        size_t bodySent;
+        uint32_t head;                  // ring indices, free-running
+        uint32_t tail;
+        size_t toConsume;               // read by the parser, window not reopened yet
+        uint8_t buf[STREAM_WINDOW];
+    };
+
+    const char* host;
+    uint16_t port;
+    ResumableTlsClient client;
+    nghttp2_session_callbacks* callbacks = nullptr;
+    nghttp2_option* options = nullptr;
+    nghttp2_session* session = nullptr;
+    SemaphoreHandle_t mutex = NULL;
+    StreamSlot slots[MAX_STREAMS];
+
+    // Statistics
+    uint32_t connects = 0;
+    uint32_t streams = 0;
+    uint32_t resets = 0;                // streams cancelled before their end
+    size_t active = 0;
+    size_t peakActive = 0;
+    uint64_t headerBytesRaw = 0;        // request header names and values
+    uint64_t headerBytesSent = 0;       // the same after HPACK
+
+    // The slot of a live stream; NULL once the slot was released (or reused)
+    static StreamSlot* slotFor(nghttp2_session* s, int32_t id) {
+        StreamSlot* slot = (StreamSlot*)nghttp2_session_get_stream_user_data(s, id);
+        return (slot && slot->id == id) ? slot : nullptr;
+    }
+
+    static ssize_t onSend(nghttp2_session*, const uint8_t* data, size_t length, int, void* user) {
+        Http2Connection* self = (Http2Connection*)user;
+        size_t written = self->client.write(data, length);
+        return written > 0 ? (ssize_t)written : (ssize_t)NGHTTP2_ERR_CALLBACK_FAILURE;
+    }
+
+    // Names and values arrive NUL-terminated
+    static int onHeader(nghttp2_session* s, const nghttp2_frame* frame,
+                        const uint8_t* name, size_t, const uint8_t* value, size_t,
+                        uint8_t, void*) {
+        if (frame->hd.type != NGHTTP2_HEADERS || frame->headers.cat != NGHTTP2_HCAT_RESPONSE) {
+            return 0;
+        }
+        StreamSlot* slot = slotFor(s, frame->hd.stream_id);
+        if (!slot) {
+            return 0;
+        }
+        const char* n = (const char*)name;
+        const char* v = (const char*)value;
+        if (strcmp(n, ":status") == 0) {
+            slot->status = atoi(v);
+        } else if (strcmp(n, "content-encoding") == 0) {
+            slot->gzip = strcasecmp(v, "gzip") == 0;
+        } else if (strcmp(n, "retry-after") == 0) {
+            slot->retryAfter = atol(v);
+        }
+        return 0;
+    }
+
+    static int onFrameRecv(nghttp2_session* s, const nghttp2_frame* frame, void*) {
+        if (frame->hd.type == NGHTTP2_HEADERS && frame->headers.cat == NGHTTP2_HCAT_RESPONSE) {
+            StreamSlot* slot = slotFor(s, frame->hd.stream_id);
+            if (slot) {
+                slot->headersDone = true;
+            }
+        }
+        return 0;
+    }
+
+    static int onFrameSend(nghttp2_session*, const nghttp2_frame* frame, void* user) {
+        if (frame->hd.type == NGHTTP2_HEADERS) {
+            ((Http2Connection*)user)->headerBytesSent += frame->hd.length;
+        }
+        return 0;
+    }
+
+    static int onData(nghttp2_session* s, uint8_t, int32_t id, const uint8_t* data, size_t len, void*) {
+        StreamSlot* slot = slotFor(s, id);
+        if (!slot) {
+            return 0;
+        }
+        if (slot->tail - slot->head + len > STREAM_WINDOW) {
+            // More than the window we announced: the peer broke flow control
+            nghttp2_submit_rst_stream(s, NGHTTP2_FLAG_NONE, id, NGHTTP2_FLOW_CONTROL_ERROR);
+            return 0;
+        }
+        for (size_t i = 0; i < len; i++) {
+            slot->buf[slot->tail++ & (STREAM_WINDOW - 1)] = data[i];
+        }
+        return 0;
+    }
+
+    static int onStreamClose(nghttp2_session* s, int32_t id, uint32_t errorCode, void*) {
+        StreamSlot* slot = slotFor(s, id);
+        if (slot) {
+            slot->closed = true;
+            slot->errorCode = errorCode;
+        }
+        return 0;
+    }
+
+    static ssize_t readBody(nghttp2_session*, int32_t, uint8_t* buf, size_t length,
+                            uint32_t* flags, nghttp2_data_source* source, void*) {
+        StreamSlot* slot = (StreamSlot*)source->ptr;
+        size_t left = slot->body->length() - slot->bodySent;
+        size_t n = left < length ? left : length;
+        memcpy(buf, slot->body->c_str() + slot->bodySent, n);
+        slot->bodySent += n;
+        if (slot->bodySent == slot->body->length()) {
+            *flags |= NGHTTP2_DATA_FLAG_EOF;
+        }
+        return n;
+    }
+
+    // Tear the connection down; every open stream ends with an error
+    void dropLocked() {
+        for (size_t i = 0; i < MAX_STREAMS; i++) {
+            if (slots[i].id != 0 && !slots[i].closed) {
+                slots[i].closed = true;
+                slots[i].errorCode = NGHTTP2_INTERNAL_ERROR;
+            }
+        }
+        if (session) {
+            nghttp2_session_del(session);
+            session = nullptr;
+        }
+        client.stop();
+    }
+
+    bool connectLocked() {
+        if (session && client.connected() &&
+            (nghttp2_session_want_read(session) || nghttp2_session_want_write(session))) {
+            return true;
+        }
+        if (active > 0) {
+            return false;       // finishing on a closing connection; the caller retries
+        }
+        dropLocked();
+
+        static const char* alpn[] = { "h2", nullptr };
+        client.setAlpnProtocols(alpn);
+        if (!client.connect(host, port)) {
+            Serial.println("Spotify HTTP/2 connect failed");
+            return false;
+        }
+        if (!client.negotiated("h2")) {
+            Serial.println("Spotify server did not accept HTTP/2");
+            client.stop();
+            return false;
+        }
+        if (nghttp2_session_client_new2(&session, callbacks, this, options) != 0) {
+            session = nullptr;
+            client.stop();
+            return false;
+        }
+        nghttp2_settings_entry settings[] = {
+            { NGHTTP2_SETTINGS_ENABLE_PUSH, 0 },
+            { NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, STREAM_WINDOW },
+        };
+        nghttp2_submit_settings(session, NGHTTP2_FLAG_NONE, settings, 2);
+        connects++;
+        if (nghttp2_session_send(session) != 0) {
+            dropLocked();
+            return false;
+        }
+        return true;
+    }
+
+    // One round of I/O for every stream: flush what nghttp2 wants to send,
+    // then feed it what has arrived. False if the connection is gone.
+    bool pumpLocked(bool& progress) {
+        progress = false;
+        if (!session) {
+            return false;
+        }
+        if (nghttp2_session_send(session) != 0) {
+            dropLocked();
+            return false;
+        }
+        int available = client.available();
+        if (available > 0) {
+            uint8_t in[READ_CHUNK];
+            int n = client.read(in, available < (int)READ_CHUNK ? available : READ_CHUNK);
+            if (n > 0) {
+                progress = true;
+                if (nghttp2_session_mem_recv(session, in, n) < 0 || nghttp2_session_send(session) != 0) {
+                    dropLocked();
+                    return false;
+                }
+            }
+        } else if (!client.connected()) {
+            dropLocked();
+            return false;
+        }
+        return true;
+    }
+
+    // Drive the connection until ready(slot) holds, or the timeout passes
+    template <typename Ready>
+    bool waitFor(StreamSlot& slot, Ready ready, unsigned long timeoutMs) {
+        unsigned long start = millis();
+        for (;;) {
+            xSemaphoreTake(mutex, portMAX_DELAY);
+            if (ready(slot)) {
+                xSemaphoreGive(mutex);
+                return true;
+            }
+            bool progress = false;
+            bool alive = pumpLocked(progress);
+            xSemaphoreGive(mutex);
+            if (!alive || millis() - start >= timeoutMs) {
+                return false;
+            }
+            if (!progress) {
+                delay(1);       // lets the other lane take its turn at the socket
+            }
+        }
+    }
+
+public:
+    Http2Connection(const char* hostName, uint16_t portNumber) : host(hostName), port(portNumber) {
+        memset(slots, 0, sizeof(slots));
+    }
+
+    bool begin(TlsSessionCache* sessions) {
+        mutex = xSemaphoreCreateMutex();
+#ifdef SPOTIFY_ROOT_CA
+        client.setCACert(SPOTIFY_ROOT_CA);
+#else
+        client.setInsecure();
+#endif
+        client.setSessionCache(sessions);
+
+        nghttp2_session_callbacks_new(&callbacks);
+        nghttp2_session_callbacks_set_send_callback(callbacks, onSend);
+        nghttp2_session_callbacks_set_on_header_callback(callbacks, onHeader);
+        nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks, onFrameRecv);
+        nghttp2_session_callbacks_set_on_frame_send_callback(callbacks, onFrameSend);
+        nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks, onData);
+        nghttp2_session_callbacks_set_on_stream_close_callback(callbacks, onStreamClose);
+        nghttp2_option_new(&options);
+        nghttp2_option_set_no_auto_window_update(options, 1);
+
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        bool ok = connectLocked();
+        xSemaphoreGive(mutex);
+        return ok;
+    }
+
+    // Start a request. Returns its slot, or -1 without a connection or a free slot.
+    int open(const char* method, const String& path, const String& token,
+             const String& body, bool offerGzip) {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        int index = -1;
+        for (size_t i = 0; i < MAX_STREAMS && index < 0; i++) {
+            if (slots[i].id == 0) {
+                index = i;
+            }
+        }
+        if (index < 0 || !connectLocked()) {
+            xSemaphoreGive(mutex);
+            return -1;
+        }
+        StreamSlot& slot = slots[index];
+        memset(&slot, 0, offsetof(StreamSlot, buf));
+        slot.retryAfter = -1;
+        slot.body = &body;
+
+        String auth = "Bearer " + token;
+        String length(body.length());
+        const char* names[] = { ":method", ":scheme", ":authority", ":path",
+                                "authorization", "content-length", "content-type", "accept-encoding" };
+        const char* values[] = { method, "https", host, path.c_str(),
+                                 auth.c_str(), length.c_str(), "application/json", "gzip" };
+        size_t count = 6;
+        if (body.length() > 0) {
+            count = 7;
+        }
+        nghttp2_nv nva[8];
+        for (size_t i = 0; i < count; i++) {
+            nva[i] = { (uint8_t*)names[i], (uint8_t*)values[i], strlen(names[i]), strlen(values[i]),
+                       NGHTTP2_NV_FLAG_NONE };
+        }
+        if (offerGzip) {
+            nva[count++] = { (uint8_t*)names[7], (uint8_t*)values[7], strlen(names[7]), strlen(values[7]),
+                             NGHTTP2_NV_FLAG_NONE };
+        }
+        for (size_t i = 0; i < count; i++) {
+            headerBytesRaw += nva[i].namelen + nva[i].valuelen;
+        }
+
+        nghttp2_data_provider provider;
+        provider.source.ptr = &slot;
+        provider.read_callback = readBody;
+        int32_t id = nghttp2_submit_request(session, nullptr, nva, count,
+                                            body.length() > 0 ? &provider : nullptr, &slot);
+        if (id < 0) {
+            if (active == 0) {
+                dropLocked();       // e.g. after GOAWAY: reconnect on the next request
+            }
+            xSemaphoreGive(mutex);
+            return -1;
+        }
+        slot.id = id;
+        if (nghttp2_session_send(session) != 0) {
+            dropLocked();
+            slot.id = 0;
+            xSemaphoreGive(mutex);
+            return -1;
+        }
+        streams++;
+        active++;
+        if (active > peakActive) {
+            peakActive = active;
+        }
+        xSemaphoreGive(mutex);
+        return index;
+    }
+
+    // Wait for the response headers. Returns :status, or < 0 if the stream failed.
+    int awaitStatus(int index, unsigned long timeoutMs = 5000) {
+        StreamSlot& slot = slots[index];
+        bool ok = waitFor(slot, [](StreamSlot& s) { return s.headersDone || s.closed; }, timeoutMs);
+        return (ok && slot.headersDone) ? slot.status : -1;
+    }
+
+    bool is_gzip(int index) { return slots[index].gzip; }
+    long get_retry_after(int index) { return slots[index].retryAfter; }
+
+    // Copy body bytes out of the stream, waiting for at least one. 0 = end of body.
+    size_t read(int index, uint8_t* out, size_t length, unsigned long timeoutMs = 5000) {
+        StreamSlot& slot = slots[index];
+        if (!waitFor(slot, [](StreamSlot& s) { return s.tail != s.head || s.closed; }, timeoutMs)) {
+            return 0;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        size_t n = 0;
+        while (n < length && slot.head != slot.tail) {
+            out[n++] = slot.buf[slot.head++ & (STREAM_WINDOW - 1)];
+        }
+        slot.toConsume += n;
+        if (session && slot.toConsume >= CONSUME_BATCH) {
+            nghttp2_session_consume(session, slot.id, slot.toConsume);
+            slot.toConsume = 0;
+        }
+        xSemaphoreGive(mutex);
+        return n;
+    }
+
+    // Release a slot. A stream the parser left early is cancelled. Returns
+    // true if the body arrived complete.
+    bool close(int index) {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        StreamSlot& slot = slots[index];
+        bool complete = slot.closed && slot.errorCode == 0;
+        if (session) {
+            // Give the connection window back for everything we buffered
+            nghttp2_session_consume(session, slot.id, slot.toConsume + (slot.tail - slot.head));
+            if (!slot.closed) {
+                nghttp2_submit_rst_stream(session, NGHTTP2_FLAG_NONE, slot.id, NGHTTP2_CANCEL);
+                resets++;
+            }
+            nghttp2_session_send(session);
+        }
+        slot.id = 0;
+        active--;
+        xSemaphoreGive(mutex);
+        return complete;
+    }
+
+    void printStats() {
+        Serial.printf("Spotify HTTP/2: %lu streams on %lu connections, peak %u concurrent, %lu cancelled\n",
+                      (unsigned long)streams, (unsigned long)connects, (unsigned)peakActive,
+                      (unsigned long)resets);
+        if (headerBytesRaw > 0) {
+            Serial.printf("Spotify HPACK: %lu KB of request headers sent as %lu KB (%.0f%% saved)\n",
+                          (unsigned long)(headerBytesRaw / 1024), (unsigned long)(headerBytesSent / 1024),
+                          100.0f - 100.0f * headerBytesSent / headerBytesRaw);
+        }
+    }
+};
+
+// Response body of one stream, read as the parser pulls bytes
+class Http2BodyStream : public Stream {
+private:
+    static const size_t BUFFER_SIZE = 128;
+
+    Http2Connection& connection;
+    int index;
+    bool finished = false;
+    uint8_t buf[BUFFER_SIZE];
+    size_t head = 0;
+    size_t tail = 0;
+    uint32_t bytesRead = 0;
+
+    bool fill() {
+        if (finished) {
+            return false;
+        }
+        size_t got = connection.read(index, buf, BUFFER_SIZE);
+        if (got == 0) {
+            finished = true;
+            return false;
+        }
+        head = 0;
+        tail = got;
+        bytesRead += got;
+        return true;
+    }
+
+public:
+    Http2BodyStream(Http2Connection& conn, int slot) : connection(conn), index(slot) {}
+
+    int available() override {
+        return tail - head;
+    }
+
+    int read() override {
+        if (head == tail && !fill()) {
+            return -1;
+        }
+        return buf[head++];
+    }
+
+    int peek() override {
+        if (head == tail && !fill()) {
+            return -1;
+        }
+        return buf[head];
+    }
+
+    size_t readBytes(char* buffer, size_t length) override {
+        size_t done = 0;
+        while (done < length) {
+            if (head == tail && !fill()) {
+                break;
+            }
+            size_t n = tail - head;
+            if (n > length - done) {
+                n = length - done;
+            }
+            memcpy(buffer + done, buf + head, n);
+            head += n;
+            done += n;
+        }
+        return done;
+    }
+
+    size_t write(uint8_t) override { return 0; }
+    void flush() override {}
+
+    uint32_t get_bytes_read() { return bytesRead; }
+};
+
+#endif
+
+#endif
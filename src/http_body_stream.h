@@ -0,0 +1,212 @@
+#ifndef HTTP_BODY_STREAM_H
+#define HTTP_BODY_STREAM_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+// Response body read straight from the socket, one small buffer at a time
+// Undoes chunked transfer encoding on the fly, or stops at Content-Length,
+// so ArduinoJson can parse (and filter) while the bytes arrive and the body
+// never has to sit in RAM as a String. drain() consumes whatever the parser
+// did not read, leaving a keep-alive socket at the start of the next response.
+
+class HttpBodyStream : public Stream {
+private:
+    static const size_t BUFFER_SIZE = 128;
+
+    WiFiClient* client;
+    bool chunked;
+    long remaining;             // left in this chunk or body; -1 = until close
+    bool firstChunk = true;
+    bool finished = false;
+    bool complete = false;      // reached the end the framing announced
+    unsigned long timeoutMs;
+
+    uint8_t buf[BUFFER_SIZE];
+    size_t head = 0;
+    size_t tail = 0;
+    uint32_t bytesRead = 0;     // body bytes, without chunk framing
+
+    bool waitForData() {
+        unsigned long start = millis();
+        while (!client->available()) {
+            if (!client->connected() || millis() - start >= timeoutMs) {
+                return false;
+            }
+            delay(1);
+        }
+        return true;
+    }
+
+    int rawRead() {
+        if (!waitForData()) {
+            return -1;
+        }
+        return client->read();
+    }
+
+    // Parse "<hex size>[;ext]\r\n" (after the previous chunk's CRLF).
+    // A zero size ends the body; its trailer section is skipped.
+    bool nextChunk() {
+        if (!firstChunk) {
+            if (rawRead() != '\r' || rawRead() != '\n') {
+                return false;
+            }
+        }
+        firstChunk = false;
+
+        long size = 0;
+        bool digits = false;
+        bool inExtension = false;
+        for (;;) {
+            int c = rawRead();
+            if (c < 0) {
+                return false;
+            }
+            if (c == '\n') {
+                break;
+            }
+            if (c == '\r' || inExtension) {
+                continue;
+            }
+            if (c == ';') {
+                inExtension = true;
+            } else if (isxdigit(c)) {
+                size = size * 16 + (isdigit(c) ? c - '0' : (tolower(c) - 'a' + 10));
+                digits = true;
+            } else {
+                return false;
+            }
+        }
+        if (!digits) {
+            return false;
+        }
+
+        if (size == 0) {
+            // Trailer lines, then an empty line
+            int lineLength = 0;
+            for (;;) {
+                int c = rawRead();
+                if (c < 0) {
+                    return false;
+                }
+                if (c == '\n') {
+                    if (lineLength == 0) {
+                        break;
+                    }
+                    lineLength = 0;
+                } else if (c != '\r') {
+                    lineLength++;
+                }
+            }
+            finished = true;
+            complete = true;
+        }
+        remaining = size;
+        return true;
+    }
+
+    bool fill() {
+        if (finished) {
+            return false;
+        }
+        if (remaining == 0) {
+            if (!chunked) {
+                finished = true;
+                complete = true;
+                return false;
+            }
+            if (!nextChunk()) {
+                finished = true;
+                return false;
+            }
+            if (finished) {
+                return false;
+            }
+        }
+        if (!waitForData()) {
+            // Closed: the normal end of a body without a length, an error otherwise
+            finished = true;
+            complete = (remaining < 0);
+            return false;
+        }
+
+        size_t want = BUFFER_SIZE;
+        if (remaining >= 0 && (size_t)remaining < want) {
+            want = remaining;
+        }
+        int got = client->read(buf, want);
+        if (got <= 0) {
+            finished = true;
+            return false;
+        }
+        head = 0;
+        tail = got;
+        if (remaining >= 0) {
+            remaining -= got;
+        }
+        bytesRead += got;
+        return true;
+    }
+
+public:
+    // contentLength < 0 means unknown (read until the server closes)
+    HttpBodyStream(WiFiClient* in, bool isChunked, long contentLength, unsigned long timeout = 5000)
+        : client(in), chunked(isChunked), remaining(isChunked ? 0 : contentLength),
+          timeoutMs(timeout) {}
+
+    int available() override {
+        if (head < tail) {
+            return tail - head;
+        }
+        return (!finished && client->available() > 0) ? 1 : 0;
+    }
+
+    int read() override {
+        if (head == tail && !fill()) {
+            return -1;
+        }
+        return buf[head++];
+    }
+
+    int peek() override {
+        if (head == tail && !fill()) {
+            return -1;
+        }
+        return buf[head];
+    }
+
+    size_t readBytes(char* buffer, size_t length) override {
+        size_t done = 0;
+        while (done < length) {
+            if (head == tail && !fill()) {
+                break;
+            }
+            size_t n = tail - head;
+            if (n > length - done) {
+                n = length - done;
+            }
+            memcpy(buffer + done, buf + head, n);
+            head += n;
+            done += n;
+        }
+        return done;
+    }
+
+    size_t write(uint8_t) override { return 0; }
+    void flush() override {}
+
+    // Discard the unread rest of the body. Returns true if the body ended
+    // where its framing said it would, i.e. the socket can be reused.
+    bool drain() {
+        head = tail;
+        while (fill()) {
+            head = tail;
+        }
+        return complete;
+    }
+
+    uint32_t get_bytes_read() { return bytesRead; }
+};
+
+#endif
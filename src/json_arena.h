@@ -0,0 +1,135 @@
+#ifndef JSON_ARENA_H
+#define JSON_ARENA_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Fixed-size bump allocator for the JsonDocuments of one network lane
+// The storage is a static array, so parsing replies never touches the
+// general heap and cannot fragment it over days of uptime. ArduinoJson
+// frees everything when a document goes out of scope; once nothing is
+// live the arena starts over from offset 0, and reset() checks that at the
+// start of each poll. The most recent block can grow or shrink in place
+// (ArduinoJson's string building and shrink-to-fit). If a reply ever does
+// not fit, the block falls back to malloc and is counted.
+// Each arena belongs to a single lane, so there is no locking.
+
+template <size_t SIZE>
+class JsonArena : public ArduinoJson::Allocator {
+private:
+    static const size_t ALIGN = 8;
+    static const size_t HEADER = ALIGN;         // block size, kept aligned
+    static const size_t NONE = (size_t)-1;
+
+    alignas(8) uint8_t storage[SIZE];
+    size_t used = 0;
+    size_t lastBlock = NONE;                    // offset of the most recent block
+    size_t live = 0;                            // arena blocks not yet freed
+
+    // Statistics
+    size_t peak = 0;
+    uint32_t cycles = 0;
+    uint32_t refused = 0;                       // reset() with documents still alive
+    uint32_t fallbacks = 0;                     // blocks that went to the heap
+
+    static size_t blockSize(size_t size) {
+        return (size + HEADER + ALIGN - 1) & ~(ALIGN - 1);
+    }
+
+    bool owns(const void* ptr) const {
+        return ptr >= storage && ptr < storage + SIZE;
+    }
+
+    static uint32_t& sizeOf(void* ptr) {
+        return *(uint32_t*)((uint8_t*)ptr - HEADER);
+    }
+
+public:
+    void* allocate(size_t size) override {
+        size_t block = blockSize(size);
+        if (used + block > SIZE) {
+            fallbacks++;
+            return malloc(size);
+        }
+        uint8_t* ptr = storage + used + HEADER;
+        lastBlock = used;
+        used += block;
+        live++;
+        if (used > peak) {
+            peak = used;
+        }
+        sizeOf(ptr) = size;
+        return ptr;
+    }
+
+    void deallocate(void* ptr) override {
+        if (!ptr) {
+            return;
+        }
+        if (!owns(ptr)) {
+            free(ptr);
+            return;
+        }
+        live--;
+        if ((uint8_t*)ptr - HEADER == storage + lastBlock) {
+            used = lastBlock;
+            lastBlock = NONE;
+        }
+        if (live == 0) {
+            used = 0;
+            lastBlock = NONE;
+        }
+    }
+
+    void* reallocate(void* ptr, size_t newSize) override {
+        if (!ptr) {
+            return allocate(newSize);
+        }
+        if (!owns(ptr)) {
+            return realloc(ptr, newSize);
+        }
+        size_t oldSize = sizeOf(ptr);
+        if ((uint8_t*)ptr - HEADER == storage + lastBlock) {
+            size_t block = blockSize(newSize);
+            if (lastBlock + block <= SIZE) {
+                used = lastBlock + block;
+                if (used > peak) {
+                    peak = used;
+                }
+                sizeOf(ptr) = newSize;
+                return ptr;
+            }
+        } else if (newSize <= oldSize) {
+            sizeOf(ptr) = newSize;
+            return ptr;
+        }
+        void* moved = allocate(newSize);
+        if (moved) {
+            memcpy(moved, ptr, oldSize < newSize ? oldSize : newSize);
+            deallocate(ptr);
+        }
+        return moved;
+    }
+
+    // Start of a poll: everything from the previous one must be gone by now
+    bool reset() {
+        cycles++;
+        if (live != 0) {
+            refused++;
+            return false;
+        }
+        used = 0;
+        lastBlock = NONE;
+        return true;
+    }
+
+    size_t get_peak() { return peak; }
+
+    void printStats(const char* name) {
+        Serial.printf("%s arena: peak %u/%u bytes, %lu cycles, %lu heap fallbacks, %lu refused resets\n",
+                      name, (unsigned)peak, (unsigned)SIZE, (unsigned long)cycles,
+                      (unsigned long)fallbacks, (unsigned long)refused);
+    }
+};
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include <Arduino.h>
+
+// Running latency counter (microsecond samples, reported in ms)
+// An optional budget counts samples that missed their deadline.
+class LatencyStats {
+private:
+    const char* label;
+    uint32_t budgetUs;
+    uint32_t overBudget = 0;
+    uint32_t samples = 0;
+    uint32_t lastUs = 0;
+    uint32_t maxUs = 0;
+    uint64_t totalUs = 0;
+
+public:
+    LatencyStats(const char* name, uint32_t budget = 0) : label(name), budgetUs(budget) {}
+
+    void record(uint32_t us) {
+        samples++;
+        lastUs = us;
+        totalUs += us;
+        if (us > maxUs) {
+            maxUs = us;
+        }
+        if (budgetUs != 0 && us > budgetUs) {
+            overBudget++;
+        }
+    }
+
+    uint32_t get_count() { return samples; }
+    uint32_t get_last_us() { return lastUs; }
+    uint32_t get_max_us() { return maxUs; }
+
+    uint32_t get_avg_us() {
+        return samples ? (uint32_t)(totalUs / samples) : 0;
+    }
+
+    void reset() {
+        samples = 0;
+        lastUs = 0;
+        maxUs = 0;
+        totalUs = 0;
+        overBudget = 0;
+    }
+
+    void print() {
+        Serial.printf("%s: last %.1f ms, avg %.1f ms, max %.1f ms (%lu samples",
+                      label, lastUs / 1000.0f, get_avg_us() / 1000.0f, maxUs / 1000.0f,
+                      (unsigned long)samples);
+        if (budgetUs != 0) {
+            Serial.printf(", %lu over %.0f ms", (unsigned long)overBudget, budgetUs / 1000.0f);
+        }
+        Serial.println(")");
+    }
+};
+
+#endif
@@ -0,0 +1,244 @@
+#ifndef LIKED_CACHE_H
+#define LIKED_CACHE_H
+
+#include <Arduino.h>
+#include <time.h>
+#ifdef LIKED_CACHE_NVS
+#include <Preferences.h>
+#endif
+
+// LRU cache of track id -> "saved in Liked Songs"
+// Filled by the liked check on track change, by batched checks of the
+// upcoming queue and by our own like/unlike commands. Entries expire after a
+// TTL so likes made on another device are picked up eventually.
+// With LIKED_CACHE_NVS the table is saved to flash (at most every few
+// minutes, to spare the flash) and reloaded at boot.
+// Shared by both network lanes, guarded by a spinlock.
+
+class LikedCache {
+private:
+    static const size_t CAPACITY = 64;
+    static const size_t ID_LEN = 22;                        // Spotify base62 id
+    static const unsigned long TTL_MS = 30UL * 60UL * 1000UL;
+    static const unsigned long SAVE_INTERVAL_MS = 10UL * 60UL * 1000UL;
+
+    struct Entry {
+        char id[ID_LEN + 1];
+        bool liked;
+        unsigned long storedAt;     // millis() when the answer was learned
+        uint32_t lastUsed;          // LRU stamp, 0 = free slot
+    };
+
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    Entry entries[CAPACITY];
+    uint32_t useClock = 0;
+    bool dirty = false;
+    unsigned long lastSave = 0;
+
+    // Statistics
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+
+    // Caller holds the lock. Expired entries are freed on the way.
+    Entry* find(const char* id) {
+        unsigned long now = millis();
+        for (size_t i = 0; i < CAPACITY; i++) {
+            Entry& e = entries[i];
+            if (e.lastUsed == 0 || strncmp(e.id, id, ID_LEN) != 0) {
+                continue;
+            }
+            if (now - e.storedAt >= TTL_MS) {
+                e.lastUsed = 0;
+                return nullptr;
+            }
+            return &e;
+        }
+        return nullptr;
+    }
+
+    // Caller holds the lock. Free slot first, otherwise the least recently used.
+    Entry* victim() {
+        Entry* oldest = &entries[0];
+        for (size_t i = 0; i < CAPACITY; i++) {
+            if (entries[i].lastUsed == 0) {
+                return &entries[i];
+            }
+            if (entries[i].lastUsed < oldest->lastUsed) {
+                oldest = &entries[i];
+            }
+        }
+        evictions++;
+        return oldest;
+    }
+
+    void put(const char* id, bool liked, unsigned long storedAt) {
+        Entry* e = find(id);
+        if (!e) {
+            e = victim();
+            strncpy(e->id, id, ID_LEN);
+            e->id[ID_LEN] = '\0';
+        }
+        e->liked = liked;
+        e->storedAt = storedAt;
+        e->lastUsed = ++useClock;
+    }
+
+#ifdef LIKED_CACHE_NVS
+    // Flash copy: ages are stored relative to the wall clock at save time
+    struct SavedEntry {
+        char id[ID_LEN + 1];
+        bool liked;
+        uint32_t ageSec;
+    };
+
+    static bool clockValid(time_t now) {
+        return now > 1600000000;    // NTP has synced
+    }
+#endif
+
+public:
+    LikedCache() {
+        memset(entries, 0, sizeof(entries));
+    }
+
+    // Load the saved table (no-op without LIKED_CACHE_NVS)
+    void begin() {
+#ifdef LIKED_CACHE_NVS
+        Preferences prefs;
+        if (!prefs.begin("liked", true)) {
+            return;
+        }
+        uint32_t savedAt = prefs.getUInt("saved_at", 0);
+        size_t len = prefs.getBytesLength("entries");
+        size_t count = len / sizeof(SavedEntry);
+        if (count > CAPACITY) {
+            count = CAPACITY;
+        }
+        SavedEntry* saved = new SavedEntry[count];
+        prefs.getBytes("entries", saved, count * sizeof(SavedEntry));
+        prefs.end();
+
+        // Time spent powered off counts towards the TTL when the clock allows it
+        time_t now = time(nullptr);
+        uint32_t offSec = (clockValid(now) && savedAt != 0 && (uint32_t)now > savedAt)
+                          ? (uint32_t)now - savedAt : 0;
+        size_t loaded = 0;
+        portENTER_CRITICAL(&lock);
+        for (size_t i = 0; i < count; i++) {
+            unsigned long ageMs = (unsigned long)(saved[i].ageSec + offSec) * 1000UL;
+            if (ageMs >= TTL_MS) {
+                continue;
+            }
+            saved[i].id[ID_LEN] = '\0';
+            put(saved[i].id, saved[i].liked, millis() - ageMs);
+            loaded++;
+        }
+        portEXIT_CRITICAL(&lock);
+        delete[] saved;
+        Serial.printf("Liked cache: %u entries loaded from flash\n", (unsigned)loaded);
+#endif
+    }
+
+    // Cached answer for a track; counts towards the hit rate
+    bool lookup(const String& id, bool& liked) {
+        portENTER_CRITICAL(&lock);
+        Entry* e = find(id.c_str());
+        if (e) {
+            liked = e->liked;
+            e->lastUsed = ++useClock;
+            hits++;
+        } else {
+            misses++;
+        }
+        portEXIT_CRITICAL(&lock);
+        return e != nullptr;
+    }
+
+    // Cached answer without touching stats or LRU order
+    bool peek(const String& id, bool& liked) {
+        portENTER_CRITICAL(&lock);
+        Entry* e = find(id.c_str());
+        if (e) {
+            liked = e->liked;
+        }
+        portEXIT_CRITICAL(&lock);
+        return e != nullptr;
+    }
+
+    bool contains(const String& id) {
+        bool ignored;
+        return peek(id, ignored);
+    }
+
+    void store(const String& id, bool liked) {
+        if (id.length() == 0) {
+            return;
+        }
+        portENTER_CRITICAL(&lock);
+        put(id.c_str(), liked, millis());
+        dirty = true;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Save to flash if something changed since the last save and enough time
+    // has passed. Call from a background task, not the UI loop.
+    void persistIfDue() {
+#ifdef LIKED_CACHE_NVS
+        unsigned long now = millis();
+        if (!dirty || (lastSave != 0 && now - lastSave < SAVE_INTERVAL_MS)) {
+            return;
+        }
+        time_t wall = time(nullptr);
+        if (!clockValid(wall)) {
+            return;
+        }
+
+        SavedEntry* saved = new SavedEntry[CAPACITY];
+        size_t count = 0;
+        portENTER_CRITICAL(&lock);
+        for (size_t i = 0; i < CAPACITY; i++) {
+            const Entry& e = entries[i];
+            if (e.lastUsed == 0 || now - e.storedAt >= TTL_MS) {
+                continue;
+            }
+            memcpy(saved[count].id, e.id, sizeof(saved[count].id));
+            saved[count].liked = e.liked;
+            saved[count].ageSec = (now - e.storedAt) / 1000UL;
+            count++;
+        }
+        dirty = false;
+        portEXIT_CRITICAL(&lock);
+
+        Preferences prefs;
+        if (prefs.begin("liked", false)) {
+            prefs.putUInt("saved_at", (uint32_t)wall);
+            prefs.putBytes("entries", saved, count * sizeof(SavedEntry));
+            prefs.end();
+        }
+        delete[] saved;
+        lastSave = now;
+#endif
+    }
+
+    float get_hit_rate() {
+        uint32_t total = hits + misses;
+        return total ? (float)hits / total : 0.0f;
+    }
+
+    void printStats() {
+        size_t used = 0;
+        portENTER_CRITICAL(&lock);
+        for (size_t i = 0; i < CAPACITY; i++) {
+            if (entries[i].lastUsed != 0) {
+                used++;
+            }
+        }
+        portEXIT_CRITICAL(&lock);
+        Serial.printf("Liked cache: %lu hits, %lu misses (%.0f%% hit rate), %u/%u entries, %lu evictions\n",
+                      (unsigned long)hits, (unsigned long)misses, get_hit_rate() * 100.0f,
+                      (unsigned)used, (unsigned)CAPACITY, (unsigned long)evictions);
+    }
+};
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef PLAYBACK_MODEL_H
+#define PLAYBACK_MODEL_H
+
+#include <Arduino.h>
+
+// Local playback state with optimistic updates
+// A button press applies its expected result at once and marks the field
+// pending. The field is confirmed by a successful command plus an agreeing
+// poll, and rolled back if the command fails or polls still disagree once
+// the grace period is over (Spotify can lag a command by a second or two).
+// Written by the UI loop and both network lanes, guarded by a spinlock.
+
+enum PlaybackField : uint8_t {
+    FIELD_PLAYING,
+    FIELD_SHUFFLE,
+    FIELD_LIKED,
+    FIELD_COUNT
+};
+
+class PlaybackModel {
+private:
+    struct OptimisticFlag {
+        bool confirmed = false;     // last authoritative value
+        bool shown = false;         // what the display should show
+        bool pending = false;
+        unsigned long pendingSince = 0;
+    };
+
+    static const unsigned long RECONCILE_GRACE_MS = 2500;
+
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    OptimisticFlag fields[FIELD_COUNT];
+    uint32_t version = 0;           // bumped whenever a shown value changes
+    uint8_t rollbacks = 0;          // bitmask of fields rolled back, for the UI
+
+    // Statistics
+    uint32_t applied = 0;
+    uint32_t confirmedCount = 0;
+    uint32_t rolledBack = 0;
+
+    void rollback(PlaybackField field) {
+        OptimisticFlag& f = fields[field];
+        if (f.shown != f.confirmed) {
+            f.shown = f.confirmed;
+            version++;
+        }
+        f.pending = false;
+        rollbacks |= (1 << field);
+        rolledBack++;
+    }
+
+public:
+    // UI: show the expected result of a command immediately
+    void applyOptimistic(PlaybackField field, bool value) {
+        portENTER_CRITICAL(&lock);
+        OptimisticFlag& f = fields[field];
+        if (f.shown != value) {
+            version++;
+        }
+        f.shown = value;
+        f.pending = true;
+        f.pendingSince = millis();
+        applied++;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Command lane: the API accepted (ok) or rejected the command that sets
+    // `field` to `target`
+    void onCommandResult(PlaybackField field, bool ok, bool target) {
+        portENTER_CRITICAL(&lock);
+        OptimisticFlag& f = fields[field];
+        if (!ok && f.pending) {
+            rollback(field);
+        } else if (ok && field == FIELD_LIKED) {
+            // No poll reports liked state, so the API answer is authoritative.
+            // A later press may already show the opposite; it stays pending.
+            f.confirmed = target;
+            if (f.pending && f.shown == target) {
+                f.pending = false;
+                confirmedCount++;
+            }
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Command lane: presses on `field` cancelled out before any was sent.
+    // Nothing is pending any more unless a newer press changed the display.
+    void onCommandsCancelled(PlaybackField field) {
+        portENTER_CRITICAL(&lock);
+        OptimisticFlag& f = fields[field];
+        if (f.pending && f.shown == f.confirmed) {
+            f.pending = false;
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Poll lane: authoritative value from Spotify
+    void onPolled(PlaybackField field, bool value) {
+        portENTER_CRITICAL(&lock);
+        OptimisticFlag& f = fields[field];
+        f.confirmed = value;
+        if (f.pending) {
+            if (value == f.shown) {
+                f.pending = false;
+                confirmedCount++;
+            } else if (millis() - f.pendingSince >= RECONCILE_GRACE_MS) {
+                rollback(field);
+            }
+        } else if (f.shown != value) {
+            f.shown = value;
+            version++;
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Track changed: any pending like belongs to the previous track
+    void resetField(PlaybackField field, bool value) {
+        portENTER_CRITICAL(&lock);
+        OptimisticFlag& f = fields[field];
+        if (f.shown != value) {
+            version++;
+        }
+        f.confirmed = value;
+        f.shown = value;
+        f.pending = false;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    bool get(PlaybackField field) {
+        portENTER_CRITICAL(&lock);
+        bool result = fields[field].shown;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    bool is_pending(PlaybackField field) {
+        portENTER_CRITICAL(&lock);
+        bool result = fields[field].pending;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    uint32_t get_version() {
+        portENTER_CRITICAL(&lock);
+        uint32_t result = version;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    // Fields rolled back since the last call (bit per PlaybackField)
+    uint8_t takeRollbacks() {
+        portENTER_CRITICAL(&lock);
+        uint8_t result = rollbacks;
+        rollbacks = 0;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    void printStats() {
+        Serial.printf("Optimistic UI: %lu applied, %lu confirmed, %lu rolled back\n",
+                      (unsigned long)applied, (unsigned long)confirmedCount,
+                      (unsigned long)rolledBack);
+    }
+};
+
+#endif
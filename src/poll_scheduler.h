@@ -0,0 +1,203 @@
+#ifndef POLL_SCHEDULER_H
+#define POLL_SCHEDULER_H
+
+#include <Arduino.h>
+
+// Adaptive, playback-aware poll scheduler
+// Picks the delay until the next playback poll from what we already know:
+//  - fast polls for a short window after a user command
+//  - while playing, a relaxed rate (progress is interpolated locally), but
+//    woken just after the predicted end of the track
+//  - exponential back-off while paused or when nothing is playing
+//  - +/- jitter so several controllers do not poll in lockstep
+//  - with a push channel up, events trigger the polls and the timer is only
+//    a long-interval fallback
+
+enum PollState : uint8_t {
+    POLL_PLAYING,
+    POLL_PAUSED,
+    POLL_IDLE,      // no active device (204) or empty item
+    POLL_ERROR
+};
+
+class PollScheduler {
+private:
+    static const unsigned long MIN_INTERVAL_MS = 250;
+    static const unsigned long COMMAND_INTERVAL_MS = 500;
+    static const unsigned long COMMAND_WINDOW_MS = 3000;
+    static const unsigned long PLAYING_INTERVAL_MS = 3000;
+    static const unsigned long TRACK_END_SLACK_MS = 300;
+    static const unsigned long PAUSED_BASE_MS = 2000;
+    static const unsigned long PAUSED_MAX_MS = 30000;
+    static const unsigned long IDLE_MAX_MS = 60000;
+    static const unsigned long PUSH_FALLBACK_MS = 60000;
+    static const uint8_t JITTER_PERCENT = 10;
+
+    // Commands and push events arrive from other tasks than the poll lane
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    unsigned long lastPoll = 0;
+    unsigned long lastCommand = 0;
+    unsigned long interval = 0;     // delay chosen after the last poll
+    uint8_t backoffStreak = 0;
+    bool pushLinked = false;
+    const char* reason = "startup";
+
+    // Metrics
+    uint32_t polls = 0;
+    uint32_t pushPolls = 0;
+    uint64_t intervalTotal = 0;
+    unsigned long startedAt = 0;
+
+    unsigned long withJitter(unsigned long ms) {
+        long span = (long)(ms * JITTER_PERCENT / 100);
+        if (span <= 0) {
+            return ms;
+        }
+        return ms + random(-span, span + 1);
+    }
+
+public:
+    // A user command was sent; state is about to change
+    void onCommand() {
+        portENTER_CRITICAL(&lock);
+        lastCommand = millis();
+        backoffStreak = 0;
+        if (interval > COMMAND_INTERVAL_MS) {
+            interval = COMMAND_INTERVAL_MS;
+            reason = "command";
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // The push channel came up or went down
+    void setPushLinked(bool up) {
+        portENTER_CRITICAL(&lock);
+        pushLinked = up;
+        if (!up) {
+            // Fall back to timed polling straight away
+            interval = 0;
+            reason = "push lost";
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // The push channel reported a state change: poll now
+    void onPushEvent() {
+        portENTER_CRITICAL(&lock);
+        backoffStreak = 0;
+        interval = 0;
+        reason = "push";
+        pushPolls++;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Record a finished poll and choose the delay until the next one.
+    // remainingMs is the predicted time until the current track ends (0 if unknown).
+    void onPoll(PollState state, unsigned long remainingMs) {
+        portENTER_CRITICAL(&lock);
+        unsigned long now = millis();
+        if (startedAt == 0) {
+            startedAt = now;
+        }
+        lastPoll = now;
+
+        unsigned long next;
+        if (lastCommand != 0 && now - lastCommand < COMMAND_WINDOW_MS) {
+            next = COMMAND_INTERVAL_MS;
+            reason = "command";
+            backoffStreak = 0;
+        } else if (pushLinked && state != POLL_ERROR) {
+            // Track ends, skips and pauses arrive as events
+            backoffStreak = 0;
+            next = withJitter(PUSH_FALLBACK_MS);
+            reason = "push fallback";
+        } else if (state == POLL_PLAYING) {
+            backoffStreak = 0;
+            next = withJitter(PLAYING_INTERVAL_MS);
+            reason = "playing";
+            if (remainingMs > 0 && remainingMs + TRACK_END_SLACK_MS < next) {
+                next = remainingMs + TRACK_END_SLACK_MS;
+                reason = "track end";
+            }
+        } else {
+            unsigned long cap = (state == POLL_PAUSED) ? PAUSED_MAX_MS : IDLE_MAX_MS;
+            next = PAUSED_BASE_MS << backoffStreak;
+            if (next >= cap) {
+                next = cap;
+            } else {
+                backoffStreak++;
+            }
+            next = withJitter(next);
+            reason = (state == POLL_PAUSED) ? "paused" : (state == POLL_IDLE) ? "idle" : "error";
+        }
+
+        if (next < MIN_INTERVAL_MS) {
+            next = MIN_INTERVAL_MS;
+        }
+        interval = next;
+        polls++;
+        intervalTotal += next;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Milliseconds until the next poll is due (0 = now)
+    unsigned long msUntilNextPoll() {
+        unsigned long wait = 0;
+        portENTER_CRITICAL(&lock);
+        if (polls != 0) {
+            unsigned long since = millis() - lastPoll;
+            wait = since >= interval ? 0 : interval - since;
+        }
+        portEXIT_CRITICAL(&lock);
+        return wait;
+    }
+
+    // Milliseconds the next poll is already past its scheduled time
+    unsigned long msOverdue() {
+        unsigned long late = 0;
+        portENTER_CRITICAL(&lock);
+        if (polls != 0) {
+            unsigned long since = millis() - lastPoll;
+            late = since > interval ? since - interval : 0;
+        }
+        portEXIT_CRITICAL(&lock);
+        return late;
+    }
+
+    unsigned long get_interval() {
+        portENTER_CRITICAL(&lock);
+        unsigned long ms = interval;
+        portEXIT_CRITICAL(&lock);
+        return ms;
+    }
+
+    unsigned long get_avg_interval() {
+        portENTER_CRITICAL(&lock);
+        unsigned long avg = polls ? (unsigned long)(intervalTotal / polls) : 0;
+        portEXIT_CRITICAL(&lock);
+        return avg;
+    }
+
+    // Requests per hour at the observed rate (fixed 1 Hz polling would be 3600)
+    uint32_t get_polls_per_hour() {
+        portENTER_CRITICAL(&lock);
+        unsigned long elapsed = millis() - startedAt;
+        uint32_t perHour = (polls < 2 || elapsed == 0) ? 0
+            : (uint32_t)((uint64_t)polls * 3600000UL / elapsed);
+        portEXIT_CRITICAL(&lock);
+        return perHour;
+    }
+
+    void printStats() {
+        portENTER_CRITICAL(&lock);
+        unsigned long next = interval;
+        const char* why = reason;
+        uint32_t pushed = pushPolls;
+        portEXIT_CRITICAL(&lock);
+        Serial.printf("Poll scheduler: next in %lu ms (%s), avg %lu ms, %lu polls/h vs 3600 at 1 Hz, %lu push-triggered\n",
+                      next, why, get_avg_interval(),
+                      (unsigned long)get_polls_per_hour(), (unsigned long)pushed);
+    }
+};
+
+#endif
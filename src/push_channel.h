@@ -0,0 +1,296 @@
+#ifndef PUSH_CHANNEL_H
+#define PUSH_CHANNEL_H
+
+#ifdef PUSH_EVENTS
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <ArduinoJson.h>
+#include <base64.h>
+#include <mbedtls/sha1.h>
+#include "latency_stats.h"
+#include "websocket_codec.h"
+
+// Push transport for player-state events (-DPUSH_EVENTS)
+// Holds one WebSocket open to an event source on the LAN and hands every
+// event to a callback, which triggers a targeted refresh. Polling keeps
+// running at a long fallback interval, so a dead relay only costs latency.
+// The source is chosen with PUSH_HOST / PUSH_PORT / PUSH_PATH: a relay that
+// watches the account, or a local mock (any WebSocket server that sends the
+// messages below) when testing. Messages are small JSON text frames:
+//   {"type":"player_state_changed"}   play/pause, skip, seek, device, shuffle
+//   {"type":"queue_changed"}          up-next is stale
+// Unknown types are treated as player_state_changed.
+
+#ifndef PUSH_HOST
+#define PUSH_HOST "spotify-relay.local"
+#endif
+#ifndef PUSH_PORT
+#define PUSH_PORT 8765
+#endif
+#ifndef PUSH_PATH
+#define PUSH_PATH "/events"
+#endif
+
+typedef void (*PushEventHandler)(const char* type);
+typedef void (*PushLinkHandler)(bool connected);
+
+class PushChannel {
+private:
+    static const size_t FRAME_MAX = 512;                // events are a few dozen bytes
+    static const unsigned long HANDSHAKE_TIMEOUT_MS = 3000;
+    static const unsigned long PING_INTERVAL_MS = 20000;
+    static const unsigned long IDLE_TIMEOUT_MS = 45000; // no frame, not even a pong
+    static const unsigned long RETRY_MIN_MS = 1000;
+    static const unsigned long RETRY_MAX_MS = 60000;
+    static const unsigned long READ_SLICE_MS = 50;
+
+    const char* host;
+    uint16_t port;
+    const char* path;
+    PushEventHandler onEvent = nullptr;
+    PushLinkHandler onLink = nullptr;
+
+    WiFiClient client;
+    TaskHandle_t task = NULL;
+    volatile bool linked = false;
+    unsigned long retryMs = RETRY_MIN_MS;
+    char frame[FRAME_MAX + 1];
+
+    // Statistics
+    LatencyStats connectTime{"Push connect"};
+    uint32_t events = 0;
+    uint32_t connects = 0;
+    uint32_t drops = 0;
+    unsigned long linkedSince = 0;
+    unsigned long linkedTotalMs = 0;
+
+    // Sec-WebSocket-Accept the server must answer for `key` (RFC 6455 4.2.2)
+    static String expectedAccept(const String& key) {
+        String concat = key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+        uint8_t digest[20];
+        mbedtls_sha1_ret((const uint8_t*)concat.c_str(), concat.length(), digest);
+        return base64::encode(digest, sizeof(digest));
+    }
+
+    bool handshake() {
+        uint8_t nonce[16];
+        esp_fill_random(nonce, sizeof(nonce));
+        String key = base64::encode(nonce, sizeof(nonce));
+
+        client.printf("GET %s HTTP/1.1\r\nHost: %s:%u\r\nUpgrade: websocket\r\n"
+                      "Connection: Upgrade\r\nSec-WebSocket-Key: %s\r\n"
+                      "Sec-WebSocket-Version: 13\r\n\r\n",
+                      path, host, port, key.c_str());
+
+        client.setTimeout(HANDSHAKE_TIMEOUT_MS / 1000);
+        String status = client.readStringUntil('\n');
+        if (!status.startsWith("HTTP/1.1 101")) {
+            Serial.printf("Push handshake refused: %s\n", status.c_str());
+            return false;
+        }
+        String expected = expectedAccept(key);
+        bool accepted = false;
+        for (;;) {
+            String line = client.readStringUntil('\n');
+            line.trim();
+            if (line.length() == 0) {
+                break;
+            }
+            int colon = line.indexOf(':');
+            if (colon > 0 && line.substring(0, colon).equalsIgnoreCase("Sec-WebSocket-Accept")) {
+                String value = line.substring(colon + 1);
+                value.trim();
+                accepted = value == expected;
+            }
+        }
+        return accepted;
+    }
+
+    // Client frames are masked with a fresh random key; only short control
+    // frames are ever sent
+    static void newKey(uint8_t key[4]) {
+        uint32_t mask = esp_random();
+        memcpy(key, &mask, 4);
+    }
+
+    void sendPing() {
+        uint8_t key[4];
+        uint8_t out[WS_HEADER_MAX];
+        newKey(key);
+        client.write(out, wsEncodeFrame(WS_OP_PING, nullptr, 0, key, out, sizeof(out)));
+    }
+
+    // Pong for a ping, close for a close; nothing for other frames
+    void reply(uint8_t opcode, size_t len) {
+        uint8_t key[4];
+        uint8_t out[WS_HEADER_MAX + WS_CONTROL_MAX];
+        newKey(key);
+        size_t n = wsControlReply(opcode, (const uint8_t*)frame, len, key, out, sizeof(out));
+        if (n > 0) {
+            client.write(out, n);
+        }
+    }
+
+    bool readExact(uint8_t* out, size_t len) {
+        return client.readBytes(out, len) == len;
+    }
+
+    // Read one frame into `frame`; an oversized payload is drained and
+    // reported as length 0. False when the link is broken.
+    bool readFrame(WsFrameHeader& header, size_t& len) {
+        uint8_t head[WS_HEADER_MAX];
+        if (!readExact(head, 2) || !readExact(head + 2, wsHeaderSize(head) - 2)) {
+            return false;
+        }
+        wsParseHeader(head, header);
+        uint64_t size = header.length;
+
+        len = 0;
+        if (size > FRAME_MAX) {
+            // Not an event we understand: drain it
+            uint8_t sink[64];
+            while (size > 0) {
+                size_t chunk = size > sizeof(sink) ? sizeof(sink) : (size_t)size;
+                if (!readExact(sink, chunk)) {
+                    return false;
+                }
+                size -= chunk;
+            }
+            return true;
+        }
+        if (!readExact((uint8_t*)frame, (size_t)size)) {
+            return false;
+        }
+        wsUnmask((uint8_t*)frame, (size_t)size, header.key);
+        len = (size_t)size;
+        frame[len] = '\0';
+        return true;
+    }
+
+    void dispatch(size_t len) {
+        static const char* DEFAULT_TYPE = "player_state_changed";
+        JsonDocument filter;
+        filter["type"] = true;
+        JsonDocument doc;
+        const char* type = DEFAULT_TYPE;
+        if (deserializeJson(doc, frame, len, DeserializationOption::Filter(filter)) == DeserializationError::Ok) {
+            type = doc["type"] | DEFAULT_TYPE;
+        }
+        events++;
+        if (onEvent) {
+            onEvent(type);
+        }
+    }
+
+    void setLinked(bool up) {
+        if (linked == up) {
+            return;
+        }
+        linked = up;
+        if (up) {
+            linkedSince = millis();
+        } else {
+            linkedTotalMs += millis() - linkedSince;
+            drops++;
+        }
+        if (onLink) {
+            onLink(up);
+        }
+    }
+
+    // Read frames until the link drops
+    void session() {
+        WsLink link(PING_INTERVAL_MS, IDLE_TIMEOUT_MS);
+        link.start(millis());
+
+        while (client.connected()) {
+            if (client.available() >= 2) {
+                WsFrameHeader header;
+                size_t len;
+                client.setTimeout(IDLE_TIMEOUT_MS / 1000);
+                if (!readFrame(header, len)) {
+                    break;
+                }
+                reply(header.opcode, len);
+                WsLink::Action action = link.onFrame(header, len, millis());
+                if (action == WsLink::WS_CLOSED) {
+                    break;
+                }
+                if (action == WsLink::WS_DISPATCH) {
+                    dispatch(len);
+                }
+                continue;
+            }
+
+            WsLink::Tick tick = link.tick(millis());
+            if (tick == WsLink::WS_IDLE) {
+                Serial.println("Push link idle, reconnecting");
+                break;
+            }
+            if (tick == WsLink::WS_SEND_PING) {
+                sendPing();
+            }
+            vTaskDelay(pdMS_TO_TICKS(READ_SLICE_MS));
+        }
+        client.stop();
+    }
+
+    void run() {
+        for (;;) {
+            if (WiFi.status() != WL_CONNECTED) {
+                vTaskDelay(pdMS_TO_TICKS(RETRY_MIN_MS));
+                continue;
+            }
+
+            unsigned long start = micros();
+            if (client.connect(host, port, HANDSHAKE_TIMEOUT_MS) && handshake()) {
+                connectTime.record(micros() - start);
+                connects++;
+                retryMs = RETRY_MIN_MS;
+                Serial.printf("Push channel connected to %s:%u%s\n", host, port, path);
+                setLinked(true);
+                session();
+                setLinked(false);
+                continue;
+            }
+
+            client.stop();
+            vTaskDelay(pdMS_TO_TICKS(retryMs));
+            retryMs *= 2;
+            if (retryMs > RETRY_MAX_MS) {
+                retryMs = RETRY_MAX_MS;
+            }
+        }
+    }
+
+    static void taskEntry(void* param) {
+        ((PushChannel*)param)->run();
+    }
+
+public:
+    PushChannel(const char* host, uint16_t port, const char* path)
+        : host(host), port(port), path(path) {}
+
+    // Start the connection task. Callbacks run on that task.
+    void begin(PushEventHandler eventHandler, PushLinkHandler linkHandler) {
+        onEvent = eventHandler;
+        onLink = linkHandler;
+        // Core 0 with the token refresh, below the network lanes
+        xTaskCreatePinnedToCore(taskEntry, "PushEvents", 6144, this, 1, &task, 0);
+    }
+
+    bool is_connected() { return linked; }
+
+    void printStats() {
+        unsigned long upMs = linkedTotalMs + (linked ? millis() - linkedSince : 0);
+        Serial.printf("Push channel: %s, %lu events, %lu connects, %lu drops, linked %lu s\n",
+                      linked ? "connected" : "down", (unsigned long)events,
+                      (unsigned long)connects, (unsigned long)drops, upMs / 1000);
+        connectTime.print();
+    }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef REQUEST_GOVERNOR_H
+#define REQUEST_GOVERNOR_H
+
+#include <Arduino.h>
+
+// Rate-limit-aware request governor for the Spotify Web API
+//  - token bucket shared by all requests; polls may not take the last few
+//    tokens, which stay reserved for user commands
+//  - 429 responses block everything until Retry-After has passed
+//  - 5xx and transport errors back off exponentially with jitter
+//  - after repeated failures the circuit opens: polling pauses for 30 s
+//    while user commands still go through; any answer closes it, and the
+//    first poll after the pause is the probe (one more failure reopens it)
+// Shared by the command and poll lanes, so state is guarded by a spinlock.
+
+enum RequestClass : uint8_t {
+    REQUEST_COMMAND,
+    REQUEST_POLL
+};
+
+class RequestGovernor {
+private:
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    static const uint8_t BUCKET_CAPACITY = 10;
+    static const uint8_t COMMAND_RESERVE = 3;
+    static const unsigned long REFILL_MS = 1000;        // one token per second
+    static const unsigned long DEFAULT_RETRY_AFTER_MS = 5000;
+    static const unsigned long BACKOFF_BASE_MS = 1000;
+    static const unsigned long BACKOFF_MAX_MS = 60000;
+    static const uint8_t BREAKER_THRESHOLD = 5;
+    static const unsigned long BREAKER_OPEN_MS = 30000;
+
+    float tokens = BUCKET_CAPACITY;
+    unsigned long lastRefill = 0;
+
+    unsigned long retryAfterUntil = 0;
+    unsigned long backoffUntil = 0;
+    unsigned long breakerOpenUntil = 0;
+    uint8_t failures = 0;
+    bool breakerOpen = false;
+
+    // Statistics
+    uint32_t sent = 0;
+    uint32_t throttled = 0;     // 429 responses
+    uint32_t serverErrors = 0;  // 5xx and transport errors
+    uint32_t breakerTrips = 0;
+
+    void refill() {
+        unsigned long now = millis();
+        if (lastRefill == 0) {
+            lastRefill = now;
+            return;
+        }
+        tokens += (float)(now - lastRefill) / REFILL_MS;
+        if (tokens > BUCKET_CAPACITY) {
+            tokens = BUCKET_CAPACITY;
+        }
+        lastRefill = now;
+    }
+
+    static unsigned long remaining(unsigned long until, unsigned long now) {
+        return (until != 0 && (long)(until - now) > 0) ? until - now : 0;
+    }
+
+    // Called under the lock; failures stays past the threshold until an answer
+    void expireBreaker(unsigned long now) {
+        if (breakerOpen && remaining(breakerOpenUntil, now) == 0) {
+            breakerOpen = false;
+        }
+    }
+
+public:
+    // Milliseconds until a request of this class may be sent (0 = now)
+    unsigned long msUntilAllowed(RequestClass cls) {
+        portENTER_CRITICAL(&lock);
+        refill();
+        unsigned long now = millis();
+        unsigned long wait = remaining(retryAfterUntil, now);
+        expireBreaker(now);
+
+        if (cls == REQUEST_POLL) {
+            wait = max(wait, remaining(backoffUntil, now));
+            if (breakerOpen) {
+                wait = max(wait, remaining(breakerOpenUntil, now));
+            }
+        }
+
+        float needed = (cls == REQUEST_POLL) ? 1.0f + COMMAND_RESERVE : 1.0f;
+        if (tokens < needed) {
+            wait = max(wait, (unsigned long)((needed - tokens) * REFILL_MS) + 1);
+        }
+        portEXIT_CRITICAL(&lock);
+        return wait;
+    }
+
+    // Called for every request actually put on the wire
+    void onSend() {
+        portENTER_CRITICAL(&lock);
+        refill();
+        tokens = tokens >= 1.0f ? tokens - 1.0f : 0.0f;
+        sent++;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Called with the final status of a request; retryAfterSec < 0 if absent
+    void onResult(int statusCode, long retryAfterSec) {
+        long jitter = random(0, BACKOFF_MAX_MS);
+        bool opened = false;
+        bool closed = false;
+
+        portENTER_CRITICAL(&lock);
+        unsigned long now = millis();
+        expireBreaker(now);
+
+        if (statusCode == 429) {
+            throttled++;
+            unsigned long ms = retryAfterSec >= 0 ? retryAfterSec * 1000UL : DEFAULT_RETRY_AFTER_MS;
+            retryAfterUntil = now + ms;
+            portEXIT_CRITICAL(&lock);
+            Serial.printf("Spotify rate limited, retrying after %lu ms\n", ms);
+            return;
+        }
+
+        if (statusCode < 0 || statusCode >= 500) {
+            serverErrors++;
+            if (failures < 16) {
+                failures++;
+            }
+            unsigned long backoff = BACKOFF_BASE_MS << (failures - 1);
+            if (backoff > BACKOFF_MAX_MS) {
+                backoff = BACKOFF_MAX_MS;
+            }
+            backoff += jitter % (backoff / 2 + 1);
+            backoffUntil = now + backoff;
+
+            if (failures >= BREAKER_THRESHOLD && !breakerOpen) {
+                breakerOpen = true;
+                breakerTrips++;
+                opened = true;
+            }
+            if (breakerOpen) {
+                breakerOpenUntil = now + BREAKER_OPEN_MS;
+            }
+        } else {
+            // Any other answer means the service is reachable again
+            closed = failures >= BREAKER_THRESHOLD;
+            failures = 0;
+            backoffUntil = 0;
+            breakerOpen = false;
+        }
+        portEXIT_CRITICAL(&lock);
+
+        if (opened) {
+            Serial.println("Spotify circuit breaker open, pausing polls");
+        }
+        if (closed) {
+            Serial.println("Spotify circuit breaker closed");
+        }
+    }
+
+    bool is_breaker_open() {
+        portENTER_CRITICAL(&lock);
+        expireBreaker(millis());
+        bool open = breakerOpen;
+        portEXIT_CRITICAL(&lock);
+        return open;
+    }
+
+    void printStats() {
+        portENTER_CRITICAL(&lock);
+        refill();
+        expireBreaker(millis());
+        uint32_t s = sent, t = throttled, e = serverErrors, trips = breakerTrips;
+        float left = tokens;
+        bool open = breakerOpen;
+        portEXIT_CRITICAL(&lock);
+
+        Serial.printf("Request governor: %lu sent, %lu throttled, %lu errors, %lu breaker trips, %.1f tokens%s\n",
+                      (unsigned long)s, (unsigned long)t, (unsigned long)e,
+                      (unsigned long)trips, left, open ? ", breaker OPEN" : "");
+    }
+};
+
+#endif
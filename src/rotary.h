@@ -3,22 +3,20 @@
 
 #include <Arduino.h>
 #include <ESP32Encoder.h>
+#include "debouncer.h"
 
 class RotaryEncoder {
     private:
-        uint8_t pinSW;
         ESP32Encoder encoder;
-        
-        uint16_t btnState = 0;
+        Debouncer button;       // same 20 ms debounce as the other buttons
         int32_t lastCount = 0;
 
+        static const int32_t COUNTS_PER_DETENT = 2;     // attachHalfQuad
+
     public:
-        RotaryEncoder(uint8_t SW, uint8_t DT, uint8_t CLK) {
-            pinSW = SW;
+        RotaryEncoder(uint8_t SW, uint8_t DT, uint8_t CLK) : button(SW) {
             encoder.attachHalfQuad(DT, CLK);
             encoder.setCount(0);
-
-            pinMode(SW, INPUT_PULLUP);
         }
         
         bool is_clockwise(){
@@ -39,10 +37,20 @@ class RotaryEncoder {
             return false;
         }
 
-        bool is_button_pressed(){
-            btnState = (btnState<<1) | !(digitalRead(pinSW));
+        // Signed detents turned since the last read, so fast spins keep every step.
+        // Half-quad decoding counts twice per detent; a half-turned detent is
+        // carried over to the next read.
+        int32_t read_delta(){
+            int32_t count = encoder.getCount();
+            int32_t detents = (count - lastCount) / COUNTS_PER_DETENT;
+            lastCount += detents * COUNTS_PER_DETENT;
+            return detents;
+        }
 
-            return (btnState == 0xFFF0);
+        // Once per press, after the switch has been stable for 20 ms; timed by
+        // millis(), so it does not depend on how often it is polled
+        bool is_button_pressed(){
+            return button.justPressed();
         }
 
         int32_t get_last_count(){
@@ -0,0 +1,146 @@
+#ifndef SPOTIFY_API_H
+#define SPOTIFY_API_H
+
+#include <Arduino.h>
+#include "spotify_connection.h"
+
+// The Spotify Web API calls the UI makes, independent of the client behind them
+// LeanSpotifyApi (the default) sends them over a SpotifyConnection: keep-alive
+// or HTTP/2, streamed and filtered into the lane's arena. LibrarySpotifyApi
+// (spotify_library_api.h, -DSPOTIFY_API_LIBRARY) uses the SpotifyEsp32 library
+// and is kept as the reference for the API benchmark.
+
+class SpotifyApi {
+public:
+    virtual ~SpotifyApi() {}
+
+    virtual bool begin() = 0;
+
+    virtual ApiResponse playbackState(JsonDocument* filter = nullptr) = 0;
+    virtual ApiResponse queue(JsonDocument* filter = nullptr) = 0;
+    virtual ApiResponse devices() = 0;
+    virtual ApiResponse tracksContain(const String* ids, size_t count) = 0;
+
+    virtual ApiResponse play() = 0;
+    virtual ApiResponse pause() = 0;
+    virtual ApiResponse next() = 0;
+    virtual ApiResponse previous() = 0;
+    virtual ApiResponse setVolume(int percent) = 0;
+    virtual ApiResponse setShuffle(bool on) = 0;
+    virtual ApiResponse saveTracks(const String* ids, size_t count) = 0;
+    virtual ApiResponse removeTracks(const String* ids, size_t count) = 0;
+};
+
+// Minimal client: one table row per endpoint, paths formatted into a fixed
+// buffer on the stack. HTTPClient still takes the path as a String, so that
+// one copy remains.
+class LeanSpotifyApi : public SpotifyApi {
+private:
+    enum Endpoint : uint8_t {
+        EP_PLAYBACK_STATE,
+        EP_QUEUE,
+        EP_DEVICES,
+        EP_TRACKS_CONTAIN,
+        EP_PLAY,
+        EP_PAUSE,
+        EP_NEXT,
+        EP_PREVIOUS,
+        EP_VOLUME,
+        EP_SHUFFLE,
+        EP_SAVE_TRACKS,
+        EP_REMOVE_TRACKS,
+        EP_COUNT
+    };
+
+    struct EndpointSpec {
+        const char* method;
+        const char* path;       // format with at most one %s
+    };
+
+    static const size_t MAX_IDS = 50;                       // Spotify's limit per call
+    static const size_t ID_LIST_SIZE = MAX_IDS * 23;        // 22-char ids plus commas
+    static const size_t PATH_SIZE = ID_LIST_SIZE + 48;
+
+    SpotifyConnection& session;
+
+    static const EndpointSpec& spec(Endpoint endpoint) {
+        static const EndpointSpec table[] = {
+            { "GET",    "/v1/me/player" },
+            { "GET",    "/v1/me/player/queue" },
+            { "GET",    "/v1/me/player/devices" },
+            { "GET",    "/v1/me/tracks/contains?ids=%s" },
+            { "PUT",    "/v1/me/player/play" },
+            { "PUT",    "/v1/me/player/pause" },
+            { "POST",   "/v1/me/player/next" },
+            { "POST",   "/v1/me/player/previous" },
+            { "PUT",    "/v1/me/player/volume?volume_percent=%s" },
+            { "PUT",    "/v1/me/player/shuffle?state=%s" },
+            { "PUT",    "/v1/me/tracks?ids=%s" },
+            { "DELETE", "/v1/me/tracks?ids=%s" },
+        };
+        static_assert(sizeof(table) / sizeof(table[0]) == EP_COUNT, "one row per endpoint");
+        return table[endpoint];
+    }
+
+    ApiResponse call(Endpoint endpoint, const char* arg = "", JsonDocument* filter = nullptr) {
+        const EndpointSpec& e = spec(endpoint);
+        char path[PATH_SIZE];
+        int len = snprintf(path, sizeof(path), e.path, arg);
+        if (len < 0 || (size_t)len >= sizeof(path)) {
+            ApiResponse failed;
+            failed.status_code = HTTPC_ERROR_TOO_LESS_RAM;
+            return failed;
+        }
+        return session.request(e.method, path, "", filter);
+    }
+
+    ApiResponse callWithIds(Endpoint endpoint, const String* ids, size_t count) {
+        char list[ID_LIST_SIZE];
+        size_t used = 0;
+        list[0] = '\0';
+        for (size_t i = 0; i < count && i < MAX_IDS; i++) {
+            int n = snprintf(list + used, sizeof(list) - used, i > 0 ? ",%s" : "%s", ids[i].c_str());
+            if (n < 0 || used + n >= sizeof(list)) {
+                break;
+            }
+            used += n;
+        }
+        return call(endpoint, list);
+    }
+
+public:
+    explicit LeanSpotifyApi(SpotifyConnection& connection) : session(connection) {}
+
+    bool begin() override { return session.begin(); }
+
+    ApiResponse playbackState(JsonDocument* filter) override { return call(EP_PLAYBACK_STATE, "", filter); }
+    ApiResponse queue(JsonDocument* filter) override { return call(EP_QUEUE, "", filter); }
+    ApiResponse devices() override { return call(EP_DEVICES); }
+
+    ApiResponse tracksContain(const String* ids, size_t count) override {
+        return callWithIds(EP_TRACKS_CONTAIN, ids, count);
+    }
+
+    ApiResponse play() override { return call(EP_PLAY); }
+    ApiResponse pause() override { return call(EP_PAUSE); }
+    ApiResponse next() override { return call(EP_NEXT); }
+    ApiResponse previous() override { return call(EP_PREVIOUS); }
+
+    ApiResponse setVolume(int percent) override {
+        char value[8];
+        snprintf(value, sizeof(value), "%d", percent);
+        return call(EP_VOLUME, value);
+    }
+
+    ApiResponse setShuffle(bool on) override { return call(EP_SHUFFLE, on ? "true" : "false"); }
+
+    ApiResponse saveTracks(const String* ids, size_t count) override {
+        return callWithIds(EP_SAVE_TRACKS, ids, count);
+    }
+
+    ApiResponse removeTracks(const String* ids, size_t count) override {
+        return callWithIds(EP_REMOVE_TRACKS, ids, count);
+    }
+};
+
+#endif
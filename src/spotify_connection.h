@@ -0,0 +1,425 @@
+#ifndef SPOTIFY_CONNECTION_H
+#define SPOTIFY_CONNECTION_H
+
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+#include "request_governor.h"
+#include "http_body_stream.h"
+#include "gzip_stream.h"
+#include "tls_session.h"
+#include "token_manager.h"
+#include "http2_connection.h"
+#include "latency_stats.h"
+
+// Keep-alive HTTPS session to the Spotify Web API
+// One TLS connection is opened once and reused for every poll and command.
+// It is re-established transparently when the server drops it (idle timeout)
+// or when a request fails at the transport level.
+// Reply bodies are parsed straight off the socket (see HttpBodyStream), so
+// only the filtered document is ever held in memory, whatever the payload size.
+// With a shared GzipInflater attached, replies are requested gzip-compressed
+// and inflated on the way into the parser.
+// With a TlsSessionCache attached, reconnects resume the previous TLS session
+// instead of running the full handshake.
+// The access token comes from a TokenManager shared by every session; a
+// request never refreshes it itself.
+// With SPOTIFY_USE_HTTP2 every session sends its requests as streams on one
+// shared Http2Connection instead of over its own HTTP/1.1 socket.
+
+// Override these at build time to point at a local HTTPS stand-in
+#ifndef SPOTIFY_API_HOST
+#define SPOTIFY_API_HOST "api.spotify.com"
+#endif
+#ifndef SPOTIFY_API_PORT
+#define SPOTIFY_API_PORT 443
+#endif
+
+struct ApiResponse {
+    int status_code = 0;
+    JsonDocument reply;
+
+    ApiResponse() {}
+    explicit ApiResponse(ArduinoJson::Allocator* allocator) : reply(allocator) {}
+};
+
+class SpotifyConnection {
+private:
+    TokenManager& tokens;
+    unsigned long tokenWaitMs = 0;
+    String accessToken;             // the token the current request was sent with
+
+    ResumableTlsClient client;
+    HTTPClient http;
+    unsigned long lastUsed = 0;
+    RequestGovernor* governor = nullptr;
+    GzipInflater* inflater = nullptr;
+    ArduinoJson::Allocator* allocator = nullptr;
+    TlsSessionCache* sessions = nullptr;
+#ifdef SPOTIFY_USE_HTTP2
+    Http2Connection* h2 = nullptr;
+#endif
+
+    // Statistics
+    uint32_t handshakes = 0;
+    uint32_t requests = 0;
+    uint32_t reconnects = 0;
+    uint32_t noToken = 0;           // requests failed fast while no token was available
+    unsigned long handshakeTimeTotal = 0;
+    uint64_t bodyBytes = 0;
+    uint32_t largestBody = 0;
+    uint32_t parseErrors = 0;
+    uint64_t gzipWireBytes = 0;     // compressed bytes received
+    uint64_t gzipInflatedBytes = 0; // the same replies after inflating
+    LatencyStats roundTrip;         // request() from send to parsed reply
+
+    // Server closes idle keep-alive sessions; past this we expect a fresh handshake
+    static const unsigned long IDLE_TIMEOUT_MS = 60000;
+
+    bool ensureConnected() {
+        if (client.connected() && (millis() - lastUsed) < IDLE_TIMEOUT_MS) {
+            return true;
+        }
+        client.stop();
+
+        unsigned long start = millis();
+        if (!client.connect(SPOTIFY_API_HOST, SPOTIFY_API_PORT)) {
+            Serial.println("Spotify TLS connect failed");
+            return false;
+        }
+        handshakes++;
+        handshakeTimeTotal += millis() - start;
+        return true;
+    }
+
+    // A failed request may only be sent again if the server cannot have acted
+    // on it: it never left us, or sending it twice changes nothing. A POST
+    // (next, previous) that timed out waiting for the reply may already have
+    // skipped a track.
+    static bool mayResend(const char* method, bool neverSent) {
+        return neverSent || strcmp(method, "GET") == 0 || strcmp(method, "PUT") == 0 ||
+               strcmp(method, "DELETE") == 0;
+    }
+
+    int send(const char* method, const String& path, const String& body, bool offerGzip) {
+        if (!ensureConnected()) {
+            return HTTPC_ERROR_CONNECTION_REFUSED;
+        }
+
+        http.begin(client, SPOTIFY_API_HOST, SPOTIFY_API_PORT, path, true);
+        http.addHeader("Authorization", "Bearer " + accessToken);
+        if (body.length() > 0) {
+            http.addHeader("Content-Type", "application/json");
+        } else {
+            http.addHeader("Content-Length", "0");
+        }
+        if (offerGzip) {
+            http.addHeader("Accept-Encoding", "gzip");
+        }
+        const char* collect[] = { "Retry-After", "Transfer-Encoding", "Content-Encoding" };
+        http.collectHeaders(collect, 3);
+
+        if (governor) {
+            governor->onSend();
+        }
+        int code = http.sendRequest(method, (uint8_t*)body.c_str(), body.length());
+        lastUsed = millis();
+        requests++;
+        return code;
+    }
+
+    // Body of the current response, read incrementally from the socket
+    HttpBodyStream bodyStream() {
+        bool chunked = http.header("Transfer-Encoding").equalsIgnoreCase("chunked");
+        return HttpBodyStream(http.getStreamPtr(), chunked, http.getSize());
+    }
+
+    static DeserializationError parseBody(JsonDocument& doc, Stream& in, JsonDocument* filter) {
+        if (filter) {
+            return deserializeJson(doc, in, DeserializationOption::Filter(*filter));
+        }
+        return deserializeJson(doc, in);
+    }
+
+    // Parse a 200 reply, inflating it on the way if the server sent gzip
+    void parseReply(JsonDocument& doc, Stream& in, bool gzipped, JsonDocument* filter) {
+        DeserializationError err;
+        if (gzipped) {
+            GzipStream inflated(in, *inflater);
+            err = parseBody(doc, inflated, filter);
+            if (inflated.has_failed()) {
+                Serial.println("Spotify reply inflate failed");
+            }
+            gzipInflatedBytes += inflated.get_bytes_out();
+        } else {
+            err = parseBody(doc, in, filter);
+        }
+        if (err) {
+            parseErrors++;
+            Serial.printf("Spotify reply parse failed: %s\n", err.c_str());
+        }
+    }
+
+    void countBody(uint32_t bytes) {
+        bodyBytes += bytes;
+        if (bytes > largestBody) {
+            largestBody = bytes;
+        }
+    }
+
+    // Drain what the parser left; a body that ended early leaves the socket unusable
+    void finishBody(HttpBodyStream& body) {
+        if (!body.drain()) {
+            client.stop();
+        }
+        countBody(body.get_bytes_read());
+    }
+
+    // One request over this session's HTTP/1.1 keep-alive socket
+    void requestHttp1(const char* method, const String& path, const String& body,
+                      JsonDocument* filter, bool offerGzip, ApiResponse& result) {
+        for (int attempt = 0; attempt < 2; attempt++) {
+            int code = send(method, path, body, offerGzip);
+
+            if (code < 0) {
+                // Stale keep-alive socket or dropped link, reconnect and retry once
+                http.end();
+                client.stop();
+                reconnects++;
+                result.status_code = code;
+                bool neverSent = code == HTTPC_ERROR_CONNECTION_REFUSED ||
+                                 code == HTTPC_ERROR_SEND_HEADER_FAILED ||
+                                 code == HTTPC_ERROR_NOT_CONNECTED;
+                if (!mayResend(method, neverSent)) {
+                    break;
+                }
+                continue;
+            }
+
+            if (code == 401 && attempt == 0) {
+                HttpBodyStream body = bodyStream();
+                finishBody(body);
+                http.end();
+                String rejected = accessToken;
+                tokens.invalidate(rejected);
+                if (tokens.waitFor(accessToken, tokenWaitMs) && accessToken != rejected) {
+                    continue;
+                }
+                result.status_code = code;
+                break;
+            }
+
+            result.status_code = code;
+            if (code != 204) {
+                // Parse while the bytes arrive; the filter drops unused fields before
+                // they take memory. Always drain so the socket stays usable.
+                HttpBodyStream body = bodyStream();
+                if (code == 200) {
+                    bool gzipped = offerGzip && http.header("Content-Encoding").equalsIgnoreCase("gzip");
+                    parseReply(result.reply, body, gzipped, filter);
+                    if (gzipped) {
+                        gzipWireBytes += body.get_bytes_read();
+                    }
+                }
+                finishBody(body);
+            }
+            if (governor) {
+                String retryAfter = http.header("Retry-After");
+                governor->onResult(code, retryAfter.length() > 0 ? retryAfter.toInt() : -1);
+            }
+            http.end();  // keeps the socket open when the server allows reuse
+            break;
+        }
+    }
+
+#ifdef SPOTIFY_USE_HTTP2
+    // One request as a stream on the shared HTTP/2 connection
+    void requestHttp2(const char* method, const String& path, const String& body,
+                      JsonDocument* filter, bool offerGzip, ApiResponse& result) {
+        for (int attempt = 0; attempt < 2; attempt++) {
+            if (governor) {
+                governor->onSend();
+            }
+            requests++;
+            int slot = h2->open(method, path, accessToken, body, offerGzip);
+            int code = slot >= 0 ? h2->awaitStatus(slot) : HTTPC_ERROR_CONNECTION_REFUSED;
+
+            if (code < 0) {
+                // Connection lost (or no free stream): the next open() reconnects
+                if (slot >= 0) {
+                    h2->close(slot);
+                }
+                reconnects++;
+                result.status_code = code;
+                if (!mayResend(method, slot < 0)) {
+                    break;
+                }
+                continue;
+            }
+
+            if (code == 401 && attempt == 0) {
+                h2->close(slot);
+                String rejected = accessToken;
+                tokens.invalidate(rejected);
+                if (tokens.waitFor(accessToken, tokenWaitMs) && accessToken != rejected) {
+                    continue;
+                }
+                result.status_code = code;
+                break;
+            }
+
+            result.status_code = code;
+            Http2BodyStream reply(*h2, slot);
+            if (code == 200) {
+                bool gzipped = offerGzip && h2->is_gzip(slot);
+                parseReply(result.reply, reply, gzipped, filter);
+                if (gzipped) {
+                    gzipWireBytes += reply.get_bytes_read();
+                }
+            }
+            long retryAfter = h2->get_retry_after(slot);
+            h2->close(slot);        // cancels whatever the parser did not need
+            countBody(reply.get_bytes_read());
+            if (governor) {
+                governor->onResult(code, retryAfter);
+            }
+            break;
+        }
+    }
+#endif
+
+public:
+    SpotifyConnection(TokenManager& tokenManager, const char* roundTripLabel)
+        : tokens(tokenManager), roundTrip(roundTripLabel) {}
+
+    // Open the API session (the token may still be on its way)
+    bool begin() {
+#ifdef SPOTIFY_USE_HTTP2
+        return h2 != nullptr;       // the shared connection is opened by its owner
+#else
+#ifdef SPOTIFY_ROOT_CA
+        client.setCACert(SPOTIFY_ROOT_CA);
+#else
+        client.setInsecure();
+#endif
+        http.setReuse(true);
+        return ensureConnected();
+#endif
+    }
+
+    // Request gzip replies, inflated with this (shared) inflater when it is free
+    void setInflater(GzipInflater* g) {
+        inflater = g;
+    }
+
+    // Build reply documents in this allocator (e.g. the lane's JsonArena)
+    void setAllocator(ArduinoJson::Allocator* a) {
+        allocator = a;
+    }
+
+    // Resume TLS sessions from this (shared) cache on reconnect
+    void setSessionCache(TlsSessionCache* cache) {
+        sessions = cache;
+        client.setSessionCache(cache);
+    }
+
+#ifdef SPOTIFY_USE_HTTP2
+    // Send every request as a stream on this (shared) HTTP/2 connection
+    void setHttp2(Http2Connection* connection) {
+        h2 = connection;
+    }
+#endif
+
+    // How long a request may wait for a token being refreshed (default 0: a
+    // poll just tries again next time, a command should rather be late)
+    void setTokenWait(unsigned long ms) {
+        tokenWaitMs = ms;
+    }
+
+    // Report every request and its outcome to a rate-limit governor
+    void setGovernor(RequestGovernor* g) {
+        governor = g;
+    }
+
+    // Issue a request on the shared session. The reply body is parsed into
+    // result.reply (optionally through a filter). Transport errors trigger one
+    // reconnect and retry, unless the request was a POST that may already
+    // have reached the server. A 401 wakes the token refresh and is retried
+    // once with the new token if it arrives within the token wait (commands);
+    // otherwise it is reported. Without a token the request fails once the
+    // token wait is over (at once for polls).
+    ApiResponse request(const char* method, const String& path,
+                        const String& body = "", JsonDocument* filter = nullptr) {
+        ApiResponse result = allocator ? ApiResponse(allocator) : ApiResponse();
+        if (!tokens.waitFor(accessToken, tokenWaitMs)) {
+            noToken++;
+            result.status_code = 401;
+            return result;
+        }
+        // Only worth it when there is a reply to parse; never wait for the other lane
+        bool offerGzip = inflater && strcmp(method, "GET") == 0 && inflater->tryAcquire();
+
+        unsigned long start = micros();
+#ifdef SPOTIFY_USE_HTTP2
+        requestHttp2(method, path, body, filter, offerGzip, result);
+#else
+        requestHttp1(method, path, body, filter, offerGzip, result);
+#endif
+        roundTrip.record(micros() - start);
+        if (result.status_code < 0 && governor) {
+            governor->onResult(result.status_code, -1);
+        }
+        if (offerGzip) {
+            inflater->release();
+        }
+        return result;
+    }
+
+    ApiResponse get(const String& path, JsonDocument* filter = nullptr) {
+        return request("GET", path, "", filter);
+    }
+
+    ApiResponse put(const String& path, const String& body = "") {
+        return request("PUT", path, body);
+    }
+
+    ApiResponse post(const String& path, const String& body = "") {
+        return request("POST", path, body);
+    }
+
+    ApiResponse del(const String& path) {
+        return request("DELETE", path);
+    }
+
+    uint32_t get_handshakes() { return handshakes; }
+    uint32_t get_requests() { return requests; }
+
+    // Fraction of requests that did not need a new TLS handshake
+    float get_reuse_ratio() {
+        if (requests == 0) {
+            return 0.0f;
+        }
+        uint32_t reused = requests > handshakes ? requests - handshakes : 0;
+        return (float)reused / requests;
+    }
+
+    void printStats() {
+        Serial.printf("Spotify session: %lu requests, %lu handshakes (avg %lu ms), %lu reconnects, reuse %.0f%%, %lu without token\n",
+                      (unsigned long)requests, (unsigned long)handshakes,
+                      handshakes ? handshakeTimeTotal / handshakes : 0UL,
+                      (unsigned long)reconnects, get_reuse_ratio() * 100.0f,
+                      (unsigned long)noToken);
+        Serial.printf("Spotify bodies: %lu KB streamed, largest %lu bytes, %lu parse errors\n",
+                      (unsigned long)(bodyBytes / 1024), (unsigned long)largestBody,
+                      (unsigned long)parseErrors);
+        roundTrip.print();
+        if (gzipInflatedBytes > 0) {
+            Serial.printf("Spotify gzip: %lu KB on the wire, %lu KB inflated (%.0f%% saved)\n",
+                          (unsigned long)(gzipWireBytes / 1024), (unsigned long)(gzipInflatedBytes / 1024),
+                          100.0f - 100.0f * gzipWireBytes / gzipInflatedBytes);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef SPOTIFY_LIBRARY_API_H
+#define SPOTIFY_LIBRARY_API_H
+
+#ifdef SPOTIFY_API_LIBRARY
+
+#include <Arduino.h>
+#include <SpotifyEsp32.h>
+#include "spotify_api.h"
+
+// SpotifyApi on top of the SpotifyEsp32 library, the client this project
+// started with. Only built with -DSPOTIFY_API_LIBRARY, as the reference side
+// of the API benchmark: it refreshes its own token, opens its own
+// connections and builds every reply on the heap.
+// The library keeps one HTTPClient, so both lanes take turns through a mutex.
+
+class LibrarySpotifyApi : public SpotifyApi {
+private:
+    static const size_t MAX_IDS = 50;
+
+    Spotify sp;
+    SemaphoreHandle_t mutex = NULL;
+
+    template <typename Call>
+    ApiResponse locked(Call call) {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        response r = call();
+        xSemaphoreGive(mutex);
+        ApiResponse out;
+        out.status_code = r.status_code;
+        out.reply = std::move(r.reply);
+        return out;
+    }
+
+    // The library wants the ids as a C string array
+    template <typename Call>
+    ApiResponse withIds(const String* ids, size_t count, Call call) {
+        const char* raw[MAX_IDS];
+        if (count > MAX_IDS) {
+            count = MAX_IDS;
+        }
+        for (size_t i = 0; i < count; i++) {
+            raw[i] = ids[i].c_str();
+        }
+        return locked([&]() { return call((int)count, raw); });
+    }
+
+public:
+    LibrarySpotifyApi(const char* id, const char* secret, const char* refresh)
+        : sp(id, secret, refresh) {}
+
+    bool begin() override {
+        mutex = xSemaphoreCreateMutex();
+        sp.begin();
+        return true;
+    }
+
+    ApiResponse playbackState(JsonDocument* filter) override {
+        return locked([&]() { return filter ? sp.current_playback_state(*filter) : sp.current_playback_state(); });
+    }
+
+    ApiResponse queue(JsonDocument*) override {
+        // No filter in the library: the whole queue is parsed
+        return locked([&]() { return sp.get_queue(); });
+    }
+
+    ApiResponse devices() override {
+        return locked([&]() { return sp.available_devices(); });
+    }
+
+    ApiResponse tracksContain(const String* ids, size_t count) override {
+        return withIds(ids, count, [&](int n, const char** raw) { return sp.check_user_saved_tracks(n, raw); });
+    }
+
+    ApiResponse play() override { return locked([&]() { return sp.start_resume_playback(); }); }
+    ApiResponse pause() override { return locked([&]() { return sp.pause_playback(); }); }
+    ApiResponse next() override { return locked([&]() { return sp.skip(); }); }
+    ApiResponse previous() override { return locked([&]() { return sp.previous(); }); }
+
+    ApiResponse setVolume(int percent) override {
+        return locked([&]() { return sp.set_volume(percent); });
+    }
+
+    ApiResponse setShuffle(bool on) override {
+        return locked([&]() { return sp.shuffle(on); });
+    }
+
+    ApiResponse saveTracks(const String* ids, size_t count) override {
+        return withIds(ids, count, [&](int n, const char** raw) { return sp.save_tracks_for_current_user(n, raw); });
+    }
+
+    ApiResponse removeTracks(const String* ids, size_t count) override {
+        return withIds(ids, count, [&](int n, const char** raw) { return sp.remove_user_saved_tracks(n, raw); });
+    }
+};
+
+#endif
+
+#endif
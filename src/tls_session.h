@@ -0,0 +1,411 @@
+#ifndef TLS_SESSION_H
+#define TLS_SESSION_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <Preferences.h>
+#include <esp_arduino_version.h>
+#include <mbedtls/version.h>
+#include <errno.h>
+#include "lwip/sockets.h"
+#include "latency_stats.h"
+#if __has_include("esp32/rom/crc.h")
+#include "esp32/rom/crc.h"
+#else
+#include "rom/crc.h"
+#endif
+
+// TLS session resumption for the Spotify hosts
+// TlsSessionCache keeps the last negotiated session (ticket or session id plus
+// master secret) per host in RAM and in NVS, which survives a power cycle.
+// A reconnect or a warm boot can then do the abbreviated handshake: no
+// certificate chain, no key exchange. A slot is 2604 bytes, so only the API
+// host, which reconnects most, gets its slot in RTC memory (survives a
+// software reset; 8 KB in all); the accounts host is restored from NVS.
+// NVS is only written after a full handshake, and at most every 10 minutes
+// per host; renewed tickets from resumed handshakes only go to memory.
+// The saved sessions hold key material, like the refresh token in flash.
+
+class TlsSessionCache {
+private:
+    static const size_t MAX_HOSTS = 2;              // api and accounts
+    static const size_t BLOB_MAX = 2560;            // serialized session, incl. the peer certificate
+    static const uint32_t MAGIC = 0x544C5331;
+    static const unsigned long NVS_INTERVAL_MS = 10UL * 60UL * 1000UL;
+
+    struct Slot {
+        uint32_t magic;
+        uint32_t crc;
+        uint16_t length;
+        char host[34];
+        uint8_t blob[BLOB_MAX];
+    };
+
+    SemaphoreHandle_t mutex = NULL;
+    const char* rtcHost = "";
+    unsigned long lastNvsWrite[MAX_HOSTS] = {};
+
+    // Statistics
+    uint32_t resumed = 0;
+    uint32_t full = 0;
+    uint32_t fromRtc = 0;           // sessions found in RTC memory at boot
+    uint32_t fromNvs = 0;           // sessions restored from flash at boot
+    uint32_t saveFailures = 0;
+    LatencyStats resumedTime{"TLS resumed handshake"};
+    LatencyStats fullTime{"TLS full handshake"};
+
+    // Slot 0 is not cleared by a software reset, garbage after power-on
+    // (hence the CRC); the others start empty and are filled from NVS
+    static Slot& stored(size_t index) {
+        RTC_NOINIT_ATTR static Slot rtcSaved;
+        static Slot ramSaved[MAX_HOSTS - 1];
+        return index == 0 ? rtcSaved : ramSaved[index - 1];
+    }
+
+    static uint32_t checksum(const Slot& slot) {
+        uint32_t crc = crc32_le(0, (const uint8_t*)slot.host, sizeof(slot.host));
+        return crc32_le(crc, slot.blob, slot.length);
+    }
+
+    static bool valid(const Slot& slot) {
+        return slot.magic == MAGIC && slot.length <= BLOB_MAX && checksum(slot) == slot.crc;
+    }
+
+    static size_t savedSize(const Slot& slot) {
+        return offsetof(Slot, blob) + slot.length;
+    }
+
+    static String nvsKey(size_t index) {
+        return "slot" + String(index);
+    }
+
+    // Slot holding this host, or one to (re)use when create is set; -1 otherwise.
+    // The RTC slot is kept for rtcHost, the other hosts share the rest.
+    int find(const char* host, bool create) {
+        size_t first = strcmp(host, rtcHost) == 0 ? 0 : 1;
+        size_t last = first == 0 ? 1 : MAX_HOSTS;
+        int freeSlot = -1;
+        for (size_t i = first; i < last; i++) {
+            if (stored(i).magic != MAGIC) {
+                if (freeSlot < 0) {
+                    freeSlot = i;
+                }
+            } else if (strcmp(stored(i).host, host) == 0) {
+                return i;
+            }
+        }
+        return create ? (freeSlot >= 0 ? freeSlot : first) : -1;
+    }
+
+    void writeNvs(size_t index) {
+        Preferences prefs;
+        if (!prefs.begin("tls", false)) {
+            return;
+        }
+        if (stored(index).magic == MAGIC) {
+            prefs.putBytes(nvsKey(index).c_str(), &stored(index), savedSize(stored(index)));
+        } else {
+            prefs.remove(nvsKey(index).c_str());
+        }
+        prefs.end();
+    }
+
+public:
+    // Keep what survived in RTC memory; fill the rest from NVS.
+    // host (the busiest one) gets the RTC slot.
+    void begin(const char* host) {
+        mutex = xSemaphoreCreateMutex();
+        rtcHost = host;
+        Preferences prefs;
+        bool haveNvs = prefs.begin("tls", true);
+        for (size_t i = 0; i < MAX_HOSTS; i++) {
+            Slot& slot = stored(i);
+            if (valid(slot)) {
+                fromRtc++;
+                continue;
+            }
+            slot.magic = 0;
+            if (!haveNvs) {
+                continue;
+            }
+            size_t len = prefs.getBytesLength(nvsKey(i).c_str());
+            if (len < offsetof(Slot, blob) || len > sizeof(Slot)) {
+                continue;
+            }
+            prefs.getBytes(nvsKey(i).c_str(), &slot, len);
+            if (valid(slot) && savedSize(slot) == len) {
+                fromNvs++;
+            } else {
+                slot.magic = 0;
+            }
+        }
+        if (haveNvs) {
+            prefs.end();
+        }
+        Serial.printf("TLS sessions: %lu from RTC memory, %lu from flash\n",
+                      (unsigned long)fromRtc, (unsigned long)fromNvs);
+    }
+
+    // Offer the saved session for host on a context that has not shaken hands yet
+    bool load(const char* host, mbedtls_ssl_context* ssl) {
+        if (!mutex) {
+            return false;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        bool offered = false;
+        int index = find(host, false);
+        if (index >= 0 && valid(stored(index))) {
+            mbedtls_ssl_session session;
+            mbedtls_ssl_session_init(&session);
+            if (mbedtls_ssl_session_load(&session, stored(index).blob, stored(index).length) == 0) {
+                offered = mbedtls_ssl_set_session(ssl, &session) == 0;
+            }
+            mbedtls_ssl_session_free(&session);
+        }
+        xSemaphoreGive(mutex);
+        return offered;
+    }
+
+    // Remember the session of a finished handshake. toFlash for new sessions.
+    void save(const char* host, mbedtls_ssl_context* ssl, bool toFlash) {
+        if (!mutex || strlen(host) >= sizeof(Slot::host)) {
+            return;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        int index = find(host, true);
+        if (index < 0) {
+            xSemaphoreGive(mutex);
+            return;
+        }
+        Slot& slot = stored(index);
+        mbedtls_ssl_session session;
+        mbedtls_ssl_session_init(&session);
+        size_t length = 0;
+        bool ok = mbedtls_ssl_get_session(ssl, &session) == 0 &&
+                  mbedtls_ssl_session_save(&session, slot.blob, BLOB_MAX, &length) == 0;
+        mbedtls_ssl_session_free(&session);
+        if (ok) {
+            strlcpy(slot.host, host, sizeof(slot.host));
+            slot.length = length;
+            slot.crc = checksum(slot);
+            slot.magic = MAGIC;
+        } else {
+            slot.magic = 0;     // too big or not resumable: don't offer a stale one
+            saveFailures++;
+        }
+
+        unsigned long now = millis();
+        if (toFlash && (lastNvsWrite[index] == 0 || now - lastNvsWrite[index] >= NVS_INTERVAL_MS)) {
+            lastNvsWrite[index] = now;
+            writeNvs(index);
+        }
+        xSemaphoreGive(mutex);
+    }
+
+    // The server refused the handshake with a saved session: never offer it again
+    void forget(const char* host) {
+        if (!mutex) {
+            return;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        int index = find(host, false);
+        if (index >= 0) {
+            stored(index).magic = 0;
+            writeNvs(index);
+        }
+        xSemaphoreGive(mutex);
+    }
+
+    void recordHandshake(bool wasResumed, uint32_t us) {
+        if (wasResumed) {
+            resumed++;
+            resumedTime.record(us);
+        } else {
+            full++;
+            fullTime.record(us);
+        }
+    }
+
+    uint32_t get_resumed() { return resumed; }
+    uint32_t get_full() { return full; }
+
+    void printStats() {
+        Serial.printf("TLS: %lu resumed, %lu full handshakes, %lu sessions not saved\n",
+                      (unsigned long)resumed, (unsigned long)full, (unsigned long)saveFailures);
+        resumedTime.print();
+        fullTime.print();
+    }
+};
+
+// ResumableTlsClient copies the core's start_ssl_client() and uses the
+// protected members of WiFiClientSecure and mbedTLS 2 handshake state. Both
+// change between major versions without a compile error, so check it against
+// the new core before moving the platform pin in platformio.ini.
+#if !defined(ESP_ARDUINO_VERSION_MAJOR) || ESP_ARDUINO_VERSION_MAJOR != 2
+#error "ResumableTlsClient is written against arduino-esp32 2.x (see platformio.ini)"
+#endif
+#if MBEDTLS_VERSION_MAJOR != 2
+#error "ResumableTlsClient is written against mbedTLS 2.x"
+#endif
+
+// WiFiClientSecure that offers (and records) a cached session when connecting
+// Replaces the core's start_ssl_client() for the two connect() calls our code
+// and HTTPClient make. It fills the same sslclient_context, so reading,
+// writing and stop() are untouched. The handshake runs step by step: a full
+// handshake passes through the server Certificate state, a resumed one skips it.
+
+class ResumableTlsClient : public WiFiClientSecure {
+private:
+    TlsSessionCache* sessions = nullptr;
+
+    // TCP connect with a timeout, then the TLS handshake. Returns the socket or < 0.
+    int startSession(const IPAddress& ip, uint16_t port, const char* host, bool& resumed) {
+        sslclient_context* ctx = sslclient;
+        ctx->socket = lwip_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (ctx->socket < 0) {
+            return -1;
+        }
+        fcntl(ctx->socket, F_SETFL, fcntl(ctx->socket, F_GETFL, 0) | O_NONBLOCK);
+
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = ip;
+        addr.sin_port = htons(port);
+        int res = lwip_connect(ctx->socket, (struct sockaddr*)&addr, sizeof(addr));
+        if (res < 0 && errno != EINPROGRESS) {
+            return -1;
+        }
+        fd_set fdset;
+        FD_ZERO(&fdset);
+        FD_SET(ctx->socket, &fdset);
+        struct timeval tv = { _timeout / 1000, (_timeout % 1000) * 1000 };
+        if (select(ctx->socket + 1, NULL, &fdset, NULL, &tv) <= 0) {
+            return -1;
+        }
+        int sockErr = 0;
+        socklen_t errLen = sizeof(sockErr);
+        getsockopt(ctx->socket, SOL_SOCKET, SO_ERROR, &sockErr, &errLen);
+        if (sockErr != 0) {
+            return -1;
+        }
+        int enable = 1;
+        setsockopt(ctx->socket, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        setsockopt(ctx->socket, SOL_SOCKET, SO_KEEPALIVE, &enable, sizeof(enable));
+
+        const char* pers = "esp32-tls";
+        int ret = mbedtls_ctr_drbg_seed(&ctx->drbg_ctx, mbedtls_entropy_func, &ctx->entropy_ctx,
+                                        (const unsigned char*)pers, strlen(pers));
+        if (ret == 0) {
+            ret = mbedtls_ssl_config_defaults(&ctx->ssl_conf, MBEDTLS_SSL_IS_CLIENT,
+                                              MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+        }
+        if (ret != 0) {
+            return ret;
+        }
+        if (_use_insecure) {
+            mbedtls_ssl_conf_authmode(&ctx->ssl_conf, MBEDTLS_SSL_VERIFY_NONE);
+        } else if (_CA_cert) {
+            mbedtls_x509_crt_init(&ctx->ca_cert);
+            ret = mbedtls_x509_crt_parse(&ctx->ca_cert, (const unsigned char*)_CA_cert, strlen(_CA_cert) + 1);
+            if (ret < 0) {
+                mbedtls_x509_crt_free(&ctx->ca_cert);
+                return ret;
+            }
+            mbedtls_ssl_conf_ca_chain(&ctx->ssl_conf, &ctx->ca_cert, NULL);
+            mbedtls_ssl_conf_authmode(&ctx->ssl_conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+        } else {
+            return -1;      // neither setCACert() nor setInsecure()
+        }
+        if (_alpn_protos) {
+            ret = mbedtls_ssl_conf_alpn_protocols(&ctx->ssl_conf, _alpn_protos);
+            if (ret != 0) {
+                return ret;
+            }
+        }
+        mbedtls_ssl_conf_rng(&ctx->ssl_conf, mbedtls_ctr_drbg_random, &ctx->drbg_ctx);
+        ret = mbedtls_ssl_setup(&ctx->ssl_ctx, &ctx->ssl_conf);
+        if (ret == 0) {
+            ret = mbedtls_ssl_set_hostname(&ctx->ssl_ctx, host);
+        }
+        if (ret != 0) {
+            return ret;
+        }
+        mbedtls_ssl_set_bio(&ctx->ssl_ctx, &ctx->socket, mbedtls_net_send, mbedtls_net_recv, NULL);
+
+        bool offered = sessions && sessions->load(host, &ctx->ssl_ctx);
+        bool sawCertificate = false;
+        unsigned long start = millis();
+        while (ctx->ssl_ctx.state != MBEDTLS_SSL_HANDSHAKE_OVER) {
+            if (ctx->ssl_ctx.state == MBEDTLS_SSL_SERVER_CERTIFICATE) {
+                sawCertificate = true;
+            }
+            ret = mbedtls_ssl_handshake_step(&ctx->ssl_ctx);
+            if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+                if (millis() - start > ctx->handshake_timeout) {
+                    return -1;
+                }
+                vTaskDelay(2);
+            } else if (ret != 0) {
+                if (offered) {
+                    sessions->forget(host);
+                }
+                return ret;
+            }
+        }
+
+        resumed = offered && !sawCertificate;
+        if (sessions) {
+            sessions->save(host, &ctx->ssl_ctx, !resumed);
+        }
+        return ctx->socket;
+    }
+
+public:
+    using WiFiClientSecure::connect;
+
+    void setSessionCache(TlsSessionCache* cache) {
+        sessions = cache;
+    }
+
+    int connect(const char* host, uint16_t port) override {
+        IPAddress ip;
+        if (!WiFi.hostByName(host, ip)) {
+            return 0;
+        }
+        stop();     // frees anything left from the previous connection
+        mbedtls_ssl_init(&sslclient->ssl_ctx);
+        mbedtls_ssl_config_init(&sslclient->ssl_conf);
+        mbedtls_ctr_drbg_init(&sslclient->drbg_ctx);
+        mbedtls_entropy_init(&sslclient->entropy_ctx);
+
+        unsigned long start = micros();
+        bool resumed = false;
+        int ret = startSession(ip, port, host, resumed);
+        _lastError = ret;
+        if (ret < 0) {
+            stop();
+            return 0;
+        }
+        _connected = true;
+        if (sessions) {
+            sessions->recordHandshake(resumed, micros() - start);
+        }
+        return 1;
+    }
+
+    // True if the server picked this protocol from setAlpnProtocols()
+    bool negotiated(const char* protocol) {
+        const char* picked = mbedtls_ssl_get_alpn_protocol(&sslclient->ssl_ctx);
+        return picked && strcmp(picked, protocol) == 0;
+    }
+
+    // HTTPClient connects through this overload
+    int connect(const char* host, uint16_t port, int32_t timeout) {
+        _timeout = timeout;
+        return connect(host, port);
+    }
+};
+
+#endif
@@ -0,0 +1,265 @@
+#ifndef TOKEN_MANAGER_H
+#define TOKEN_MANAGER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+#include <Preferences.h>
+#include <base64.h>
+#include "latency_stats.h"
+#include "tls_session.h"
+
+// Spotify access token shared by both sessions
+// The token and its expiry are saved to NVS, so a warm boot reuses a token
+// that still has time left instead of exchanging the refresh token first.
+// A background task refreshes it REFRESH_MARGIN_MS before it expires; the
+// network lanes only ever read the current token and never refresh inline.
+// After a 401 they call invalidate(), which wakes the task early; a lane that
+// must not drop its request (commands) waits briefly for the new token.
+
+#ifndef SPOTIFY_ACCOUNTS_HOST
+#define SPOTIFY_ACCOUNTS_HOST "accounts.spotify.com"
+#endif
+
+class TokenManager {
+private:
+    static const unsigned long REFRESH_MARGIN_MS = 5UL * 60UL * 1000UL;
+    static const unsigned long RETRY_MIN_MS = 2000;
+    static const unsigned long RETRY_MAX_MS = 60000;
+    static const size_t TOKEN_MAX = 400;
+
+    const char* clientId;
+    const char* clientSecret;
+    const char* refreshToken;
+    TlsSessionCache* sessions = nullptr;
+
+    SemaphoreHandle_t mutex = NULL;
+    EventGroupHandle_t events = NULL;
+    static const EventBits_t TOKEN_VALID = 1 << 0;  // set with the mutex held
+    TaskHandle_t task = NULL;
+    char token[TOKEN_MAX] = "";
+    unsigned long obtainedAt = 0;       // millis() when the token was issued
+    unsigned long lifetimeMs = 0;       // 0 = no usable token
+    unsigned long retryMs = RETRY_MIN_MS;
+
+    // Statistics
+    LatencyStats refreshTime{"Token refresh"};
+    uint32_t refreshes = 0;
+    uint32_t failures = 0;
+    uint32_t invalidations = 0;
+    bool restored = false;              // current token came from NVS
+
+    static bool clockValid(time_t now) {
+        return now > 1600000000;        // NTP has synced
+    }
+
+    // ms until the background refresh is due (0 = now)
+    unsigned long msUntilRefresh() {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        unsigned long age = millis() - obtainedAt;
+        unsigned long due = lifetimeMs > REFRESH_MARGIN_MS ? lifetimeMs - REFRESH_MARGIN_MS : 0;
+        xSemaphoreGive(mutex);
+        return age >= due ? 0 : due - age;
+    }
+
+    void loadSaved() {
+        Preferences prefs;
+        if (!prefs.begin("token", true)) {
+            return;
+        }
+        String saved = prefs.getString("access", "");
+        uint32_t issuedAt = prefs.getUInt("issued_at", 0);
+        uint32_t expiresAt = prefs.getUInt("expires_at", 0);
+        prefs.end();
+
+        time_t now = time(nullptr);
+        if (saved.length() == 0 || saved.length() >= TOKEN_MAX || !clockValid(now) ||
+            (uint32_t)now < issuedAt || (uint32_t)now >= expiresAt) {
+            return;
+        }
+        strlcpy(token, saved.c_str(), sizeof(token));
+        unsigned long ageMs = ((uint32_t)now - issuedAt) * 1000UL;
+        obtainedAt = millis() - ageMs;
+        lifetimeMs = (expiresAt - issuedAt) * 1000UL;
+        restored = true;
+    }
+
+    void save(uint32_t expiresInSec) {
+        time_t now = time(nullptr);
+        if (!clockValid(now)) {
+            return;
+        }
+        Preferences prefs;
+        if (prefs.begin("token", false)) {
+            prefs.putString("access", token);
+            prefs.putUInt("issued_at", (uint32_t)now);
+            prefs.putUInt("expires_at", (uint32_t)now + expiresInSec);
+            prefs.end();
+        }
+    }
+
+    // Exchange the refresh token for a new access token (short-lived session)
+    bool refresh() {
+        unsigned long start = micros();
+        ResumableTlsClient authClient;
+#ifdef SPOTIFY_ROOT_CA
+        authClient.setCACert(SPOTIFY_ROOT_CA);
+#else
+        authClient.setInsecure();
+#endif
+        authClient.setSessionCache(sessions);
+        HTTPClient auth;
+        auth.begin(authClient, SPOTIFY_ACCOUNTS_HOST, 443, "/api/token", true);
+        auth.addHeader("Authorization",
+                       "Basic " + base64::encode(String(clientId) + ":" + clientSecret));
+        auth.addHeader("Content-Type", "application/x-www-form-urlencoded");
+
+        String body = "grant_type=refresh_token&refresh_token=" + String(refreshToken);
+        int code = auth.POST(body);
+        if (code != 200) {
+            Serial.printf("Spotify token refresh failed: %d\n", code);
+            auth.end();
+            failures++;
+            return false;
+        }
+
+        JsonDocument filter;
+        filter["access_token"] = true;
+        filter["expires_in"] = true;
+        JsonDocument doc;
+        deserializeJson(doc, auth.getString(), DeserializationOption::Filter(filter));
+        auth.end();
+
+        const char* fresh = doc["access_token"] | "";
+        uint32_t expiresIn = doc["expires_in"] | 3600;
+        if (strlen(fresh) == 0 || strlen(fresh) >= TOKEN_MAX) {
+            failures++;
+            return false;
+        }
+
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        strlcpy(token, fresh, sizeof(token));
+        obtainedAt = millis();
+        lifetimeMs = expiresIn * 1000UL;
+        restored = false;
+        xEventGroupSetBits(events, TOKEN_VALID);
+        xSemaphoreGive(mutex);
+
+        save(expiresIn);
+        refreshes++;
+        refreshTime.record(micros() - start);
+        return true;
+    }
+
+    void run() {
+        for (;;) {
+            unsigned long wait = msUntilRefresh();
+            if (wait == 0 && WiFi.status() == WL_CONNECTED) {
+                if (refresh()) {
+                    retryMs = RETRY_MIN_MS;
+                    continue;
+                }
+                wait = retryMs;
+                retryMs *= 2;
+                if (retryMs > RETRY_MAX_MS) {
+                    retryMs = RETRY_MAX_MS;
+                }
+            } else if (wait == 0) {
+                wait = RETRY_MIN_MS;
+            }
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+        }
+    }
+
+    static void taskEntry(void* param) {
+        ((TokenManager*)param)->run();
+    }
+
+public:
+    TokenManager(const char* id, const char* secret, const char* refresh)
+        : clientId(id), clientSecret(secret), refreshToken(refresh) {}
+
+    void setSessionCache(TlsSessionCache* cache) {
+        sessions = cache;
+    }
+
+    // Reuse the saved token if it is still valid, then start the refresh task.
+    // Call after NTP sync so the saved expiry can be checked.
+    void begin() {
+        mutex = xSemaphoreCreateMutex();
+        events = xEventGroupCreate();
+        loadSaved();
+        if (restored) {
+            xEventGroupSetBits(events, TOKEN_VALID);
+            Serial.printf("Spotify token restored, %lu s left\n",
+                          (unsigned long)(get_expires_in_ms() / 1000));
+        }
+        // Core 0 below the network lanes: a refresh never delays a command
+        xTaskCreatePinnedToCore(taskEntry, "TokenRefresh", 8192, this, 2, &task, 0);
+    }
+
+    // Current token, or false if there is none yet (never blocks on the network)
+    bool get(String& out) {
+        if (!mutex) {
+            return false;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        bool ok = lifetimeMs != 0 && millis() - obtainedAt < lifetimeMs;
+        if (ok) {
+            out = token;
+        } else {
+            xEventGroupClearBits(events, TOKEN_VALID);
+        }
+        xSemaphoreGive(mutex);
+        return ok;
+    }
+
+    // Like get(), but waits up to timeoutMs for a refresh in progress
+    bool waitFor(String& out, unsigned long timeoutMs) {
+        unsigned long start = millis();
+        while (!get(out)) {
+            unsigned long waited = millis() - start;
+            if (!events || waited >= timeoutMs) {
+                return false;
+            }
+            xEventGroupWaitBits(events, TOKEN_VALID, pdFALSE, pdTRUE,
+                                pdMS_TO_TICKS(timeoutMs - waited));
+        }
+        return true;
+    }
+
+    // A request using `rejected` got a 401: refresh now unless already replaced
+    void invalidate(const String& rejected) {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        bool current = rejected == token;
+        if (current) {
+            lifetimeMs = 0;
+            invalidations++;
+            xEventGroupClearBits(events, TOKEN_VALID);
+        }
+        xSemaphoreGive(mutex);
+        if (current && task) {
+            xTaskNotifyGive(task);
+        }
+    }
+
+    unsigned long get_age_ms() {
+        return millis() - obtainedAt;
+    }
+
+    unsigned long get_expires_in_ms() {
+        unsigned long age = get_age_ms();
+        return age < lifetimeMs ? lifetimeMs - age : 0;
+    }
+
+    void printStats() {
+        Serial.printf("Token: age %lu s, expires in %lu s%s, %lu refreshes, %lu failures, %lu invalidated\n",
+                      get_age_ms() / 1000, get_expires_in_ms() / 1000,
+                      restored ? " (from NVS)" : "", (unsigned long)refreshes,
+                      (unsigned long)failures, (unsigned long)invalidations);
+        refreshTime.print();
+    }
+};
+
+#endif
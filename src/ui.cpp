@@ -1,5 +1,4 @@
 #include <Arduino.h>
-#include <SpotifyEsp32.h>
 #include <lvgl.h>
 #include <TFT_eSPI.h>
 #include <ui.h>
@@ -10,8 +9,63 @@
 #include "debouncer.h"
 #include "rotary.h"
 #include "output_pin.h"
-
-TaskHandle_t spotifyTaskHandle = NULL;
+#include "spotify_connection.h"
+#include "spotify_api.h"
+#include "spotify_library_api.h"
+#include "latency_stats.h"
+#include "command_queue.h"
+#include "volume_control.h"
+#include "poll_scheduler.h"
+#include "request_governor.h"
+#include "playback_model.h"
+#include "liked_cache.h"
+#include "up_next.h"
+#include "album_art.h"
+#include "json_arena.h"
+#include "tls_session.h"
+#include "push_channel.h"
+#include "display_flush.h"
+#include "invalidation_planner.h"
+#include "cpu_load.h"
+
+// Two network lanes: commands (high priority) and polling (low priority)
+TaskHandle_t commandTaskHandle = NULL;
+TaskHandle_t pollTaskHandle = NULL;
+TaskHandle_t renderTaskHandle = NULL;
+
+// Core and priority layout
+// Core 0: Wi-Fi/lwIP (system tasks, above everything here), the command and
+//         poll lanes, then token refresh and push events
+// Core 1: input (loop), LVGL rendering, then album art decode in what the
+//         render task leaves idle
+// TLS handshakes and JSON parsing therefore never preempt a frame.
+// -DNETWORK_ON_RENDER_CORE puts the lanes back on core 1 for comparison.
+#ifdef NETWORK_ON_RENDER_CORE
+const BaseType_t NETWORK_CORE = 1;
+#else
+const BaseType_t NETWORK_CORE = 0;
+#endif
+const BaseType_t UI_CORE = 1;
+const UBaseType_t COMMAND_PRIORITY = 6;
+const UBaseType_t POLL_PRIORITY = 4;
+const UBaseType_t INPUT_PRIORITY = 4;      // short bursts, must not wait for a frame
+const UBaseType_t RENDER_PRIORITY = 3;
+
+// A command that finds the token being refreshed (after a 401) waits this
+// long for the new one rather than failing
+const unsigned long COMMAND_TOKEN_WAIT_MS = 3000;
+
+// Render and input pacing. The buttons, the rotary switch included, debounce
+// over 20 ms by millis(), so polling them every 5 ms loses nothing; the render
+// task sleeps between deadlines.
+const uint32_t INPUT_POLL_MS = 5;
+const uint32_t RENDER_MAX_SLEEP_MS = 1000;
+const uint32_t RENDER_IDLE_REFR_MS = 1000;     // LVGL refresh timer while nothing moves
+const uint32_t RENDER_ACTIVE_HOLD_MS = 500;    // full rate this long after the last change
+static volatile uint32_t renderWakeups = 0;
+static volatile uint32_t renderNotified = 0;
+static volatile uint32_t inputWakeups = 0;
+CpuLoad cpuLoad;
 
 /*buttons definitions*/
 #define buttonPrev 25   // Previous track
@@ -37,16 +91,29 @@ outputPin led(outputPinLED);
 #define CLK 13
 RotaryEncoder rotary(SW, DT, CLK);
 
-// Add these global flags with your other globals
-static bool requestPlay = false;
-static bool requestNextTrack = false;
-static bool requestPrevTrack = false;
-static bool requestStop = false;
-static bool increaseVolume = false;
-static bool decreaseVolume = false;
-static bool toggleMute = false;
-static bool toggleShuffle = false;
-static bool toggleLike = false;
+// Input -> Spotify task command queue
+const size_t COMMAND_QUEUE_DEPTH = 16;
+CommandQueue commandQueue;
+
+// Locally tracked volume, echoed on screen and sent once the knob settles
+VolumeControl volumeControl;
+static int displayedVolume = -1;
+
+// Press-to-dispatch latency (press timestamp until its request is sent)
+const uint32_t COMMAND_DEADLINE_US = 50000;
+LatencyStats dispatchLatency("Press-to-request", COMMAND_DEADLINE_US);
+
+// Poll start delay past its scheduled time
+const uint32_t POLL_DEADLINE_US = 1000000;
+LatencyStats pollLateness("Poll start delay", POLL_DEADLINE_US);
+
+// Spotify's "last changed" timestamp until the change is handed to the screen;
+// compares push and polling on the same footing
+LatencyStats stateChangeLatency("State change to screen");
+static bool polledPlaying = false;
+
+// Set while the command lane is sending, so the poll lane holds back
+static volatile bool commandInFlight = false;
 
 // LED state and timing
 static bool ledActive = false;
@@ -59,40 +126,152 @@ String cachedArtist = "";
 String cachedTrack = "";
 String cachedDeviceName = "";
 
-/* Thread-safe handoff to main core */
+/* Thread-safe handoff to the render task */
 static String nextArtist = "";
 static String nextTrack = "";
 static String nextDevice = "";
 static bool newArtist = false;
 static bool newTrack = false;
 static bool newDevice = false;
-static bool isShuffle = false;
+static String nextAlbumId = "";
+static String nextArtUrl = "";
+static bool newAlbum = false;
+static String cachedAlbumId = "";
 static String currentTrackId = "";
-static bool isLiked = false;
 SemaphoreHandle_t data_mutex = NULL;
 
 // curr and end time
 unsigned long cachedProgress = 0;
 unsigned long cachedDuration = 0;
 unsigned long progressTimestamp = 0;  // When we last got progress from API
-bool isCurrentlyPlaying = false;
+
+// Liked state per track, and metadata for the upcoming queue. The queue is
+// refetched when fewer than UPCOMING_REFETCH_BELOW entries remain ahead.
+LikedCache likedCache;
+UpNextQueue upNext;
+const size_t UPCOMING_REFETCH_BELOW = 5;
+const size_t LIKED_BATCH_MAX = 50;         // /v1/me/tracks/contains limit
+const uint32_t QUEUE_PREFETCH_MIN_HEAP = 48 * 1024;
+
+// Cover art for ui_Image3, decoded by its own low-priority task
+AlbumArt albumArt;
+
+// Last values seen by the poll lane (poll lane only); the displayed ones can
+// run ahead of these after an optimistic skip
+static String polledTrackId = "";
+static String polledContext = "";
+static bool polledShuffle = false;
+
+// Playing/shuffle/liked as shown on screen, updated optimistically on press
+PlaybackModel playbackModel;
+static uint32_t shownModelVersion = 0;
+const unsigned long ROLLBACK_FLASH_MS = 800;
+static unsigned long rollbackFlashUntil = 0;
 
 /*Screen settings*/
 static const uint16_t screenWidth  = 240;
 static const uint16_t screenHeight = 320;
 
-// LVGL buffer - dynamic allocation
+// LVGL strip buffers (two, DMA-capable) - dynamic allocation
 enum { SCREENBUFFER_SIZE_PIXELS = screenWidth * screenHeight / 10 };
-static lv_color_t* buf = nullptr;
 
 TFT_eSPI tft = TFT_eSPI( screenWidth, screenHeight );
-Spotify sp(CLIENT_ID, CLIENT_SECRET, REFRESH_TOKEN);
+DisplayFlush displayFlush(tft, SCREENBUFFER_SIZE_PIXELS);
+InvalidationPlanner invalidationPlanner;
+// Each lane owns a keep-alive session so a slow poll never holds the socket a command needs
+// Both share one access token, refreshed in the background before it expires
+TokenManager tokens(CLIENT_ID, CLIENT_SECRET, REFRESH_TOKEN);
+SpotifyConnection commandSession(tokens, "Command round trip");
+SpotifyConnection pollSession(tokens, "Poll round trip");
+#ifdef SPOTIFY_USE_HTTP2
+// Both lanes' requests as concurrent streams on one connection
+Http2Connection http2(SPOTIFY_API_HOST, SPOTIFY_API_PORT);
+#endif
+
+// The endpoints each lane calls, on the lean client or the reference library
+#ifdef SPOTIFY_API_LIBRARY
+LibrarySpotifyApi libraryApi(CLIENT_ID, CLIENT_SECRET, REFRESH_TOKEN);
+SpotifyApi& commandApi = libraryApi;
+SpotifyApi& pollApi = libraryApi;
+#else
+LeanSpotifyApi leanCommandApi(commandSession);
+LeanSpotifyApi leanPollApi(pollSession);
+SpotifyApi& commandApi = leanCommandApi;
+SpotifyApi& pollApi = leanPollApi;
+#endif
 
 // Timing for non-blocking updates
 unsigned long lastSpotifyUpdate = 0;
 unsigned long lastTimeUpdate = 0;
 const unsigned long SPOTIFY_UPDATE_INTERVAL = 1000;
 const unsigned long TIME_UPDATE_INTERVAL = 1000;
+const uint32_t SESSION_STATS_EVERY = 60;  // polls between session/scheduler reports
+static uint32_t pollCount = 0;
+PollScheduler pollScheduler;
+RequestGovernor governor;
+
+// Saved TLS sessions for api/accounts.spotify.com, shared by both sessions
+TlsSessionCache tlsSessions;
+
+#ifdef PUSH_EVENTS
+// Player-state events from a LAN relay; polling drops to a long fallback
+PushChannel pushChannel(PUSH_HOST, PUSH_PORT, PUSH_PATH);
+static volatile bool pushQueueStale = false;
+
+// Both run on the push task: mark what changed and wake the poll lane
+void handlePushEvent(const char* type) {
+    if (strcmp(type, "queue_changed") == 0) {
+        pushQueueStale = true;
+    } else {
+        pollScheduler.onPushEvent();
+    }
+    if (pollTaskHandle != NULL) {
+        xTaskNotifyGive(pollTaskHandle);
+    }
+}
+
+void handlePushLink(bool up) {
+    pollScheduler.setPushLinked(up);
+    if (pollTaskHandle != NULL) {
+        xTaskNotifyGive(pollTaskHandle);
+    }
+}
+#endif
+
+// One fixed inflate budget shared by both sessions for gzip replies
+GzipInflater inflater;
+
+// Reply documents live in a static arena per lane, never on the general heap.
+// The filters are built once at boot and reused by every request.
+JsonArena<12 * 1024> pollArena;
+JsonArena<4 * 1024> commandArena;
+JsonDocument playbackFilter;
+JsonDocument volumeFilter;
+JsonDocument queueFilter;
+
+void buildFilters() {
+    playbackFilter["progress_ms"] = true;
+    playbackFilter["is_playing"] = true;
+    playbackFilter["item"]["name"] = true;
+    playbackFilter["item"]["id"] = true;
+    playbackFilter["item"]["duration_ms"] = true;
+    playbackFilter["item"]["artists"][0]["name"] = true;
+    playbackFilter["item"]["album"]["id"] = true;
+    playbackFilter["item"]["album"]["images"][0]["url"] = true;
+    playbackFilter["item"]["album"]["images"][0]["width"] = true;
+    playbackFilter["device"]["name"] = true;
+    playbackFilter["shuffle_state"] = true;
+    playbackFilter["device"]["volume_percent"] = true;
+    playbackFilter["context"]["uri"] = true;
+    playbackFilter["timestamp"] = true;
+
+    volumeFilter["device"]["volume_percent"] = true;
+
+    queueFilter["queue"][0]["id"] = true;
+    queueFilter["queue"][0]["name"] = true;
+    queueFilter["queue"][0]["duration_ms"] = true;
+    queueFilter["queue"][0]["artists"][0]["name"] = true;
+}
 
 #if LV_USE_LOG != 0
 void my_print(const char * buf) {
@@ -101,19 +280,6 @@ void my_print(const char * buf) {
 }
 #endif
 
-// LVGL Display Flush Callback
-void my_disp_flush (lv_display_t *disp, const lv_area_t *area, uint8_t *pixelmap) {
-    uint32_t w = ( area->x2 - area->x1 + 1 );
-    uint32_t h = ( area->y2 - area->y1 + 1 );
-
-    tft.startWrite();
-    tft.setAddrWindow( area->x1, area->y1, w, h );
-    tft.pushColors( (uint16_t*) pixelmap, w * h, true );
-    tft.endWrite();
-
-    lv_disp_flush_ready( disp );
-}
-
 // LVGL Touchpad Read Callback (Placeholder - no actual touch logic)
 void my_touchpad_read (lv_indev_t * indev_driver, lv_indev_data_t * data) {
     uint16_t touchX = 0, touchY = 0;
@@ -147,7 +313,7 @@ String formatTime(unsigned long ms) {
 
 // Calculates estimated track progress based on last API call and elapsed time
 unsigned long getEstimatedProgress() {
-    if (!isCurrentlyPlaying || cachedDuration == 0) {
+    if (!playbackModel.get(FIELD_PLAYING) || cachedDuration == 0) {
         return cachedProgress;
     }
     
@@ -163,51 +329,143 @@ unsigned long getEstimatedProgress() {
     return estimated;
 }
 
-// Worker function to fetch Spotify data (runs on Core 1)
+// Ask Spotify about up to LIKED_BATCH_MAX ids in one request and cache the answers
+static bool fetchLikedBatch(const String* ids, size_t count) {
+    ApiResponse resp = pollApi.tracksContain(ids, count);
+    if (resp.status_code != 200) {
+        return false;
+    }
+    // One boolean per requested id, in request order
+    JsonArray answers = resp.reply.as<JsonArray>();
+    for (size_t i = 0; i < count && i < answers.size(); i++) {
+        likedCache.store(ids[i], answers[i].as<bool>());
+    }
+    return true;
+}
+
+// Keep the up-next list topped up. When it runs low, refetch the queue
+// (metadata for instant skips) and check every upcoming id not cached yet in
+// one batch, so the heart is already right when those tracks start.
+static void prefetchUpNext() {
+    if (upNext.remaining() >= UPCOMING_REFETCH_BELOW) {
+        return;
+    }
+
+    // Prefetching is optional: never spend command tokens or a tight heap on it
+    if (governor.msUntilAllowed(REQUEST_POLL) > 0 || ESP.getMaxAllocHeap() < QUEUE_PREFETCH_MIN_HEAP) {
+        return;
+    }
+
+    ApiResponse queue_resp = pollApi.queue(&queueFilter);
+    if (queue_resp.status_code != 200) {
+        return;
+    }
+
+    String missing[LIKED_BATCH_MAX];
+    size_t missingCount = 0;
+    upNext.clear();
+    for (JsonVariant item : queue_resp.reply["queue"].as<JsonArray>()) {
+        const char* id = item["id"];
+        if (!id) {
+            continue;   // local files and some episodes have no id
+        }
+        upNext.add(id, item["name"] | "", item["artists"][0]["name"] | "",
+                   item["duration_ms"] | 0);
+        if (missingCount < LIKED_BATCH_MAX && !likedCache.contains(id)) {
+            bool duplicate = false;
+            for (size_t i = 0; i < missingCount; i++) {
+                if (missing[i] == id) {
+                    duplicate = true;
+                    break;
+                }
+            }
+            if (!duplicate) {
+                missing[missingCount++] = id;
+            }
+        }
+    }
+    if (missingCount > 0) {
+        fetchLikedBatch(missing, missingCount);
+    }
+}
+
+// Render and input wakeups since the last report, and where the CPU went
+void printRenderStats() {
+    static uint32_t lastWakeups = 0;
+    static uint32_t lastNotified = 0;
+    static uint32_t lastInput = 0;
+    static unsigned long lastAt = 0;
+
+    unsigned long now = millis();
+    float seconds = (now - lastAt) / 1000.0f;
+    if (lastAt != 0 && seconds > 0) {
+        Serial.printf("Render task: %.1f wakeups/s (%.1f/s notified), input loop %.1f wakeups/s\n",
+                      (renderWakeups - lastWakeups) / seconds,
+                      (renderNotified - lastNotified) / seconds,
+                      (inputWakeups - lastInput) / seconds);
+    }
+    lastWakeups = renderWakeups;
+    lastNotified = renderNotified;
+    lastInput = inputWakeups;
+    lastAt = now;
+    cpuLoad.printStats();
+}
+
+// Worker function to fetch Spotify data (runs on the poll lane)
 void updateSpotifyData() {
     unsigned long startTime = millis();
 
+    // Every document of the previous poll is gone; start the arena over
+    pollArena.reset();
+
     // API call to get playback state
-    JsonDocument filter;
-    filter["progress_ms"] = true;
-    filter["is_playing"] = true;
-    filter["item"]["name"] = true;
-    filter["item"]["id"] = true;
-    filter["item"]["duration_ms"] = true;
-    filter["item"]["artists"][0]["name"] = true;
-    filter["device"]["name"] = true;
-    filter["shuffle_state"] = true;
-    
-    response playback_resp = sp.current_playback_state(filter);
+    ApiResponse playback_resp = pollApi.playbackState(&playbackFilter);
 
     unsigned long elapsed = millis() - startTime;
     Serial.printf("Spotify API calls took %lu ms\n", elapsed);
+    if (++pollCount % SESSION_STATS_EVERY == 0) {
+        pollSession.printStats();
+        commandSession.printStats();
+        tlsSessions.printStats();
+#ifdef SPOTIFY_USE_HTTP2
+        http2.printStats();
+#endif
+        tokens.printStats();
+#ifdef PUSH_EVENTS
+        pushChannel.printStats();
+#endif
+        pollScheduler.printStats();
+        stateChangeLatency.print();
+        pollLateness.print();
+        playbackModel.printStats();
+        likedCache.printStats();
+        upNext.printStats();
+        pollArena.printStats("Poll");
+        commandArena.printStats("Command");
+        governor.printStats();
+        displayFlush.printStats();
+        invalidationPlanner.printStats();
+        printRenderStats();
+    }
 
     if (playback_resp.status_code == 200) {
         JsonDocument& doc = playback_resp.reply;
         
-        // Extract all data from single response
-        String artist = "";
-        String track = "";
-        String trackId = "";
-        String deviceName = "";
+        // Extract all data from single response. Text fields point into the
+        // reply (arena memory); Strings are only touched when a value changes.
+        const char* artist = doc["item"]["artists"][0]["name"] | "";
+        const char* track = doc["item"]["name"] | "";
+        const char* trackId = doc["item"]["id"] | "";
+        const char* deviceName = doc["device"]["name"] | "";
+        const char* context = doc["context"]["uri"] | "";
+        const char* albumId = doc["item"]["album"]["id"] | "";
+        const char* artUrl = "";
         unsigned long progress = 0;
         unsigned long duration = 0;
         bool playing = false;
         bool shuffle = false;
+        int volume = -1;
         
-        if (doc["item"]["artists"][0]["name"]) {
-            artist = doc["item"]["artists"][0]["name"].as<String>();
-        }
-        if (doc["item"]["name"]) {
-            track = doc["item"]["name"].as<String>();
-        }
-        if (doc["item"]["id"]) {
-            trackId = doc["item"]["id"].as<String>();
-        }
-        if (doc["device"]["name"]) {
-            deviceName = doc["device"]["name"].as<String>();
-        }
         if (doc["progress_ms"]) {
             progress = doc["progress_ms"].as<unsigned long>();
         }
@@ -220,36 +478,92 @@ void updateSpotifyData() {
         if(doc["shuffle_state"]){
             shuffle = doc["shuffle_state"].as<bool>();
         }
+        // Smallest cover that still fills the image (Spotify offers 640, 300 and 64 px)
+        int artWidth = 0;
+        for (JsonVariant image : doc["item"]["album"]["images"].as<JsonArray>()) {
+            int width = image["width"] | 0;
+            if (artUrl[0] == '\0' || (width >= ART_SIZE && (artWidth < ART_SIZE || width < artWidth))) {
+                artWidth = width;
+                artUrl = image["url"] | "";
+            }
+        }
+        if (!doc["device"]["volume_percent"].isNull()) {
+            volume = doc["device"]["volume_percent"].as<int>();
+        }
+        volumeControl.onPolled(volume);
+
+        // Let the scheduler pick the next poll from what we just learned
+        if (track[0] == '\0') {
+            pollScheduler.onPoll(POLL_IDLE, 0);
+        } else if (playing) {
+            pollScheduler.onPoll(POLL_PLAYING, duration > progress ? duration - progress : 0);
+        } else {
+            pollScheduler.onPoll(POLL_PAUSED, 0);
+        }
+
+        // A new context or shuffle order makes the prefetched queue wrong
+        if (polledContext != context || shuffle != polledShuffle) {
+            polledContext = context;
+            polledShuffle = shuffle;
+            upNext.clear();
+        }
+
+        // Liked state and the up-next list only move when the track changes
+        bool trackChanged = trackId[0] != '\0' && polledTrackId != trackId;
+        if (trackChanged) {
+            polledTrackId = trackId;
+            upNext.advance(trackId);
+        }
+
+        // Age of the change Spotify reports, once the clock is synced
+        if (trackChanged || playing != polledPlaying) {
+            struct timeval tv;
+            gettimeofday(&tv, nullptr);
+            uint64_t nowMs = (uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+            uint64_t changedMs = doc["timestamp"] | (uint64_t)0;
+            if (tv.tv_sec > 1600000000 && changedMs != 0 && nowMs > changedMs &&
+                nowMs - changedMs < 600000) {
+                stateChangeLatency.record((uint32_t)(nowMs - changedMs) * 1000UL);
+            }
+            polledPlaying = playing;
+        }
+
+        // While an optimistic skip is on its way, a poll that still reports
+        // the old track must not pull the display back
+        bool holdDisplay = upNext.skipsPending();
 
         // Update cached values with mutex for thread-safe handoff
-        bool shouldCheckLiked = false;
-        String trackIdToCheck;
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            if (artist.length() > 0 && artist != cachedArtist) {
+        if (!holdDisplay && xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
+            if (artist[0] != '\0' && cachedArtist != artist) {
                 cachedArtist = artist;
                 nextArtist = artist;
                 newArtist = true;
-                //Serial.println("Artist fetched: " + artist);
+                //Serial.printf("Artist fetched: %s\n", artist);
             }
 
-            if (track.length() > 0 && track != cachedTrack) {
+            if (track[0] != '\0' && cachedTrack != track) {
                 cachedTrack = track;
                 nextTrack = track;
                 newTrack = true;
-                //Serial.println("Track fetched: " + track);
+                //Serial.printf("Track fetched: %s\n", track);
             }
 
-            if (trackId.length() > 0 && trackId != currentTrackId) {
+            if (trackId[0] != '\0' && currentTrackId != trackId) {
                 currentTrackId = trackId;
-                trackIdToCheck = trackId;
-                shouldCheckLiked = true; // only check liked when track changes
             }
 
-            if (deviceName.length() > 0 && deviceName != cachedDeviceName) {
+            if (cachedAlbumId != albumId) {
+                cachedAlbumId = albumId;
+                nextAlbumId = albumId;
+                nextArtUrl = artUrl;
+                newAlbum = true;
+            }
+
+            if (deviceName[0] != '\0' && cachedDeviceName != deviceName) {
                 cachedDeviceName = deviceName;
                 nextDevice = deviceName;
                 newDevice = true;
-                //Serial.println("Device fetched: " + deviceName);
+                //Serial.printf("Device fetched: %s\n", deviceName);
             }
             
             // Cache progress/duration
@@ -257,39 +571,40 @@ void updateSpotifyData() {
                 cachedProgress = progress;
                 cachedDuration = duration;
                 progressTimestamp = millis();
-                isCurrentlyPlaying = playing;
                 Serial.printf("Progress: %s / %s\n", 
                              formatTime(progress).c_str(), 
                              formatTime(duration).c_str());
             }
-            
-            //set shuffle state
-            isShuffle = shuffle;
 
             xSemaphoreGive(data_mutex);
         }
 
-        // Check "Liked Songs" status only when track changes
-        if (shouldCheckLiked && trackIdToCheck.length() > 0) {
-            const char* ids[1] = { trackIdToCheck.c_str() };
-            response liked_resp = sp.check_user_saved_tracks(1, ids);
-            if (liked_resp.status_code == 200 && !liked_resp.reply.isNull()) {
-                bool liked = false;
-                // Spotify returns an array of booleans, index 0 corresponds to our single id
-                if (liked_resp.reply[0]) {
-                    liked = liked_resp.reply[0].as<bool>();
-                }
-                if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-                    isLiked = liked;
-                    xSemaphoreGive(data_mutex);
-                }
-                //Serial.printf("Liked Songs check: %s\n", liked ? "LIKED" : "NOT LIKED");
+        // Reconcile optimistic state against the authoritative poll
+        playbackModel.onPolled(FIELD_PLAYING, playing);
+        playbackModel.onPolled(FIELD_SHUFFLE, shuffle);
+
+        // Liked state only needs looking at when the track changes
+        if (trackChanged) {
+            bool liked = false;
+            if (likedCache.lookup(polledTrackId, liked)) {
+                // New track: its liked state replaces anything pending for the old one
+                playbackModel.resetField(FIELD_LIKED, liked);
+            } else if (fetchLikedBatch(&polledTrackId, 1) && likedCache.peek(polledTrackId, liked)) {
+                playbackModel.resetField(FIELD_LIKED, liked);
             } else {
-                //Serial.printf("Failed to check liked songs, code: %d\n", liked_resp.status_code);
+                //Serial.printf("Failed to check liked songs for %s\n", trackId);
             }
+            likedCache.persistIfDue();
         }
+        if (track[0] != '\0') {
+            prefetchUpNext();
+        }
+    } else if (playback_resp.status_code == 204) {
+        // Nothing is playing on any device
+        pollScheduler.onPoll(POLL_IDLE, 0);
     } else {
         Serial.printf("Spotify API error: %d\n", playback_resp.status_code);
+        pollScheduler.onPoll(POLL_ERROR, 0);
     }
 }
 
@@ -301,11 +616,18 @@ void updateTimeDisplay() {
     lv_label_set_text(ui_DATE, currentDate.c_str());
 }
 //===================== button checks ========================
+// Light the LED for LED_HOLD_TIME after an action was sent
+void activateLed() {
+    if(!ledActive) {
+        led.setHigh();
+        ledActive = true;
+        ledStartTime = millis();
+        //Serial.println("LED turned ON (1 second hold)");
+    }
+}
+
 int get_current_volume() {
-    JsonDocument filter;
-    filter["device"]["volume_percent"] = true;
-    
-    response data = sp.current_playback_state(filter);
+    ApiResponse data = commandApi.playbackState(&volumeFilter);
     
     // Just check if the reply contains the data
     if (!data.reply.isNull() && data.reply.containsKey("device")) {
@@ -318,240 +640,579 @@ int get_current_volume() {
 
 bool buttonFlag(void){
     // the goal of this function is to speed up the API CALL
-    return requestPlay || requestNextTrack || requestPrevTrack || requestStop || increaseVolume || decreaseVolume || toggleMute || toggleShuffle || toggleLike;
+    return commandQueue.pending();
 }
 
-void executeButtonAction(){
-    bool doPlay = false;
-    bool doNextTrack = false;
-    bool doPrevTrack = false;
-    bool doStop = false;
-    bool doIncreaseVolume = false;
-    bool doDecreaseVolume = false;
-    bool doToggleMute = false;
-    bool doToggleShuffle = false;
-    bool doToggleLike = false;
-    String trackIdForLike;
-    bool currentLikeState = false;
-
-    if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-        doPlay = requestPlay;
-        doNextTrack = requestNextTrack;
-        doPrevTrack = requestPrevTrack;
-        doStop = requestStop;
-        doIncreaseVolume = increaseVolume;
-        doDecreaseVolume = decreaseVolume;
-        doToggleMute = toggleMute;
-        doToggleShuffle = toggleShuffle;
-        doToggleLike = toggleLike;
-        trackIdForLike = currentTrackId;
-        currentLikeState = isLiked;
-
-        // Reset requests
-        requestPlay = false;
-        requestNextTrack = false;
-        requestPrevTrack = false;
-        requestStop = false;
-        increaseVolume = false;
-        decreaseVolume = false;
-        toggleMute = false;
-        toggleShuffle = false;
-        toggleLike = false;
-
-        xSemaphoreGive(data_mutex);
+static bool logCommandResult(const char* name, const ApiResponse& resp) {
+    if (resp.status_code < 200 || resp.status_code >= 300) {
+        Serial.printf("%s failed: %d\n", name, resp.status_code);
+        return false;
     }
+    return true;
+}
 
-    if(doPlay){
+// Send one (already coalesced) command to Spotify
+void executeCommand(const Command& cmd){
+    switch (cmd.type) {
+    case CMD_PLAY:
         Serial.println("Executing Play");
-        sp.start_resume_playback();
-    }
-    if(doStop){
+        playbackModel.onCommandResult(FIELD_PLAYING,
+            logCommandResult("Play", commandApi.play()), true);
+        break;
+    case CMD_PAUSE:
         Serial.println("Executing Stop");
-        sp.pause_playback();
-    }
-    if(doNextTrack){
+        playbackModel.onCommandResult(FIELD_PLAYING,
+            logCommandResult("Stop", commandApi.pause()), false);
+        break;
+    case CMD_NEXT:
         Serial.println("Executing Next Track");
-        sp.skip();
-    }
-    if(doPrevTrack){
+        logCommandResult("Next Track", commandApi.next());
+        break;
+    case CMD_PREV:
         Serial.println("Executing Previous Track");
-        sp.previous();
-    }
-    if(doIncreaseVolume){
-        int currentVolume = get_current_volume();
-        if(currentVolume >= 0 && currentVolume < 100){
-            int newVolume = min(currentVolume + 2, 100);
-            Serial.printf("Increasing volume from %d to %d\n", currentVolume, newVolume);
-            sp.set_volume(newVolume);
-        } else {
-            Serial.println("Unable to get current volume for increase.");
-        }
+        logCommandResult("Previous Track", commandApi.previous());
+        break;
+    case CMD_TOGGLE_SHUFFLE: {
+        // arg carries the state the display already shows
+        bool newShuffleState = cmd.arg != 0;
+        //Serial.printf("Setting shuffle to %s\n", newShuffleState ? "true" : "false");
+
+        ApiResponse shuffle_resp = commandApi.setShuffle(newShuffleState);
+        playbackModel.onCommandResult(FIELD_SHUFFLE, logCommandResult("Shuffle", shuffle_resp),
+                                      newShuffleState);
+        break;
     }
-    if(doDecreaseVolume){
-        int currentVolume = get_current_volume();
-        if(currentVolume >= 0 && currentVolume > 0){
-            int newVolume = max(currentVolume - 2, 0);
-            Serial.printf("Decreasing volume from %d to %d\n", currentVolume, newVolume);
-            sp.set_volume(newVolume);
-        } else {
-            Serial.println("Unable to get current volume for decrease.");
+    case CMD_TOGGLE_LIKE: {
+        String trackIdForLike;
+        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
+            trackIdForLike = currentTrackId;
+            xSemaphoreGive(data_mutex);
         }
-    }
-    if(doToggleMute){
-        int currentVolume = get_current_volume();
-        if(currentVolume >= 0){
-            if(currentVolume > 0){
-                Serial.printf("Muting volume from %d to 0\n", currentVolume);
-                sp.set_volume(0);
-            } else {
-                Serial.println("Unmuting volume to 20\n");
-                sp.set_volume(20); // Unmute to a default level
-            }
+        if(trackIdForLike.length() == 0) {
+            //Serial.println("Cannot toggle like: no track ID available");
+            playbackModel.onCommandResult(FIELD_LIKED, false, cmd.arg != 0);
+            break;
+        }
+
+        ApiResponse like_resp;
+        if(cmd.arg != 0) {
+            // Display shows liked, so save it
+            like_resp = commandApi.saveTracks(&trackIdForLike, 1);
         } else {
-            Serial.println("Unable to get current volume for mute toggle.");
+            // Display shows not liked, so remove it
+            like_resp = commandApi.removeTracks(&trackIdForLike, 1);
+        }
+        bool ok = logCommandResult("Like", like_resp);
+        if (ok) {
+            likedCache.store(trackIdForLike, cmd.arg != 0);
         }
+        playbackModel.onCommandResult(FIELD_LIKED, ok, cmd.arg != 0);
+        break;
     }
-    if(doToggleShuffle){
-        //Serial.printf("Toggling Shuffle (current state: %s)\n", isShuffle ? "ON" : "OFF");
-        bool newShuffleState = !isShuffle;
-        //Serial.printf("Calling sp.shuffle(%s)\n", newShuffleState ? "true" : "false");
+#ifdef LANE_BENCHMARK
+    case CMD_BENCH_PROBE:
+        commandApi.devices();
+        break;
+#endif
+    }
+}
 
-        response shuffle_resp = sp.shuffle(newShuffleState);
+void executeButtonAction(){
+    commandArena.reset();
+    Command cmds[COMMAND_QUEUE_DEPTH];
+    uint32_t cancelled = 0;
+    size_t count = commandQueue.drain(cmds, COMMAND_QUEUE_DEPTH, &cancelled);
+
+    // Toggle pairs that cancelled out get no result; no poll reports liked state
+    if (cancelled & (1UL << CMD_TOGGLE_LIKE)) {
+        playbackModel.onCommandsCancelled(FIELD_LIKED);
+    }
+    if (cancelled & (1UL << CMD_TOGGLE_SHUFFLE)) {
+        playbackModel.onCommandsCancelled(FIELD_SHUFFLE);
+    }
 
-        //Serial.printf("Shuffle response code: %d\n", shuffle_resp.status_code);
-        if(shuffle_resp.status_code == 204 || shuffle_resp.status_code == 200) {
-            //Serial.println("Shuffle toggled successfully");
-            // UPDATE LOCAL STATE IMMEDIATELY:
-            isShuffle = newShuffleState;
-        } else {
-            //Serial.printf("Shuffle toggle failed with code: %d\n", shuffle_resp.status_code);
-        }
+    for (size_t i = 0; i < count; i++) {
+        dispatchLatency.record(micros() - cmds[i].timestampUs);
+        executeCommand(cmds[i]);
     }
-    if(doToggleLike){
-        if(trackIdForLike.length() > 0) {
-            //Serial.printf("Toggling Like (current state: %s)\n", currentLikeState ? "LIKED" : "NOT LIKED");
-            const char* ids[1] = { trackIdForLike.c_str() };
-            response like_resp;
-            
-            if(currentLikeState) {
-                // Currently liked, so unlike it
-                //Serial.println("Removing track from Liked Songs");
-                like_resp = sp.remove_user_saved_tracks(1, ids);
-            } else {
-                // Currently not liked, so like it
-                //Serial.println("Adding track to Liked Songs");
-                like_resp = sp.save_tracks_for_current_user(1, ids);
-            }
-            
-            //Serial.printf("Like toggle response code: %d\n", like_resp.status_code);
-            if(like_resp.status_code == 200 || like_resp.status_code == 204) {
-                //Serial.println("Like status toggled successfully");
-                // Update local state immediately
-                if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-                    isLiked = !currentLikeState;
-                    xSemaphoreGive(data_mutex);
-                }
-            } else {
-                //Serial.printf("Like toggle failed with code: %d\n", like_resp.status_code);
-            }
-        } else {
-            //Serial.println("Cannot toggle like: no track ID available");
-        }
+
+    if (count > 0) {
+        dispatchLatency.print();
+        commandQueue.printStats();
+        pollScheduler.onCommand();
+        activateLed();
     }
-    
-    // Activate LED if any button action was executed
-    if(doPlay || doNextTrack || doPrevTrack || doStop || doIncreaseVolume || doDecreaseVolume || doToggleMute || doToggleShuffle || doToggleLike) {
-        if(!ledActive) {
-            led.setHigh();
-            ledActive = true;
-            ledStartTime = millis();
-            //Serial.println("LED turned ON (1 second hold)");
-        }
+}
+
+// Send the settled volume target as one set_volume call
+bool sendSettledVolume(){
+    commandArena.reset();
+    if (volumeControl.needsBase()) {
+        volumeControl.onPolled(get_current_volume());
+    }
+
+    int target = volumeControl.takeTarget();
+    if (target < 0) {
+        return false;
+    }
+    Serial.printf("Setting volume to %d\n", target);
+    logCommandResult("Set volume", commandApi.setVolume(target));
+    pollScheduler.onCommand();
+    activateLed();
+    return true;
+}
+
+static void wakeSpotifyTask() {
+    if (commandTaskHandle != NULL) {
+        xTaskNotifyGive(commandTaskHandle);
+    }
+}
+
+// Something on screen changed; the render task may be sleeping until its next timer
+static void wakeRender() {
+    if (renderTaskHandle != NULL) {
+        xTaskNotifyGive(renderTaskHandle);
+    }
+}
+
+// Queue a command for the command lane and wake it immediately
+static void raiseRequest(CommandType type, int16_t arg = 0) {
+    commandQueue.push(type, arg);
+    wakeSpotifyTask();
+}
+
+// Freeze or resume the interpolated progress at its current estimate, then
+// show the new playing state before the command is even sent
+static void applyPlaying(bool playing) {
+    if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
+        cachedProgress = getEstimatedProgress();
+        progressTimestamp = millis();
+        xSemaphoreGive(data_mutex);
+    }
+    playbackModel.applyOptimistic(FIELD_PLAYING, playing);
+    wakeRender();
+}
+
+// Flip a toggle on screen and queue the command that makes it true
+static void applyToggle(PlaybackField field, CommandType type) {
+    bool target = !playbackModel.get(field);
+    playbackModel.applyOptimistic(field, target);
+    wakeRender();
+    raiseRequest(type, target ? 1 : 0);
+}
+
+// Show the prefetched next track right away; the following poll confirms it.
+// Without a prefetched entry the display simply waits for the poll as before.
+static void showUpNext() {
+    UpNextTrack track;
+    if (!upNext.takeNext(track)) {
+        return;
+    }
+    if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
+        cachedTrack = track.name;
+        nextTrack = cachedTrack;
+        newTrack = true;
+        cachedArtist = track.artist;
+        nextArtist = cachedArtist;
+        newArtist = true;
+        currentTrackId = track.id;
+        cachedProgress = 0;
+        cachedDuration = track.durationMs;
+        progressTimestamp = millis();
+        xSemaphoreGive(data_mutex);
+    }
+    bool liked = false;
+    if (likedCache.peek(track.id, liked)) {
+        playbackModel.resetField(FIELD_LIKED, liked);
+    }
+    wakeRender();
+}
+
+// Echo the local volume target on screen
+static void showVolume(int volume) {
+    displayedVolume = volume;
+    if (volume >= 0) {
+        lv_label_set_text_fmt(ui_VOLUME, "%d%%", volume);
     }
 }
 
 void buttonChecks(){
     if(button1.justPressed()){
         Serial.println("Previous Track Button Pressed");
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            requestPrevTrack = true;
-            xSemaphoreGive(data_mutex);
-        }
+        raiseRequest(CMD_PREV);
     }
     if(button2.justPressed()){
         Serial.println("Play Button Pressed");
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            requestPlay = true;
-            xSemaphoreGive(data_mutex);
-        }
+        applyPlaying(true);
+        raiseRequest(CMD_PLAY);
     }
     if(button3.justPressed()){
         Serial.println("Pause");
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            requestStop = true;
-            xSemaphoreGive(data_mutex);
-        }
+        applyPlaying(false);
+        raiseRequest(CMD_PAUSE);
     }
     if(button4.justPressed()){
         Serial.println("Button 4: Next Track");
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            requestNextTrack = true;
-            xSemaphoreGive(data_mutex);
-        }
+        showUpNext();
+        raiseRequest(CMD_NEXT);
     }
-    if(rotary.is_clockwise()){
-        Serial.println("Rotated Clockwise");
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            increaseVolume = true;
-            xSemaphoreGive(data_mutex);
-        }
-    }
-    if(rotary.is_counterclockwise()){
-        Serial.println("Rotated Counter-Clockwise");
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            decreaseVolume = true;
-            xSemaphoreGive(data_mutex);
-        }
+    int32_t detents = rotary.read_delta();
+    if(detents != 0){
+        Serial.printf("Rotated %ld\n", (long)detents);
+        volumeControl.adjust(detents);     // echoed by the render task
+        wakeRender();
+        wakeSpotifyTask();
     }
     if(rotary.is_button_pressed()){
         Serial.println("Rotary Button Pressed");
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            toggleMute = true;
-            xSemaphoreGive(data_mutex);
-        }
+        volumeControl.toggleMute();
+        wakeRender();
+        wakeSpotifyTask();
     }
     if(button5.justPressed()){
         Serial.println("Shuffle Button Pressed");
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            toggleShuffle = true;
-            xSemaphoreGive(data_mutex);
-        }
+        upNext.clear();     // queue order is about to change
+        applyToggle(FIELD_SHUFFLE, CMD_TOGGLE_SHUFFLE);
     }
     if(button6.justPressed()){
         Serial.println("Like Button Pressed");
-        if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE) {
-            toggleLike = true;
-            xSemaphoreGive(data_mutex);
-        }
+        applyToggle(FIELD_LIKED, CMD_TOGGLE_LIKE);
     }
 }
 
-// RTOS Task for Spotify API polling (runs on Core 1)
-void spotifyTask(void *parameter) {
+// A command or a settled volume target is waiting for the command lane
+static bool commandPending() {
+    return commandInFlight || buttonFlag() || volumeControl.msUntilDue() == 0;
+}
+
+// Command lane: high priority, woken directly by input.
+// Only waits on the governor, never on an in-flight poll.
+void commandTask(void *parameter) {
     for (;;) {
+        unsigned long wait = portMAX_DELAY;
+
         if (WiFi.status() == WL_CONNECTED) {
+            unsigned long commandWait = governor.msUntilAllowed(REQUEST_COMMAND);
+            if (commandWait == 0) {
+                commandInFlight = true;
+                bool acted = false;
+                if (buttonFlag()) {
+                    executeButtonAction();
+                    acted = true;
+                }
+                if (sendSettledVolume()) {
+                    acted = true;
+                }
+                commandInFlight = false;
+                if (acted) {
+                    wakeRender();   // a failed command rolls the display back
+                }
+                if (acted && pollTaskHandle != NULL) {
+                    // Scheduler switched to fast polls; let the poll lane re-plan
+                    xTaskNotifyGive(pollTaskHandle);
+                }
+            }
+
+            commandWait = governor.msUntilAllowed(REQUEST_COMMAND);
             if (buttonFlag()) {
-                executeButtonAction();
+                wait = commandWait;
+            }
+            long volumeDue = volumeControl.msUntilDue();
+            if (volumeDue >= 0) {
+                wait = min(wait, max((unsigned long)volumeDue, commandWait));
             }
-            else{
+        } else if (buttonFlag()) {
+            wait = SPOTIFY_UPDATE_INTERVAL;
+        }
+        ulTaskNotifyTake(pdTRUE, wait == portMAX_DELAY ? portMAX_DELAY : pdMS_TO_TICKS(wait));
+    }
+}
+
+#ifdef SCHED_BENCHMARK
+// How late the render task wakes for its planned deadline (frame timer or
+// clock tick); about one tick when it gets the core whenever it wants it
+LatencyStats renderWakeDelay("Render wake delay");
+static volatile uint32_t burstPolls = 0;
+
+static void recordWakeDelay(uint32_t plannedUs) {
+    int32_t late = (int32_t)(micros() - plannedUs);
+    renderWakeDelay.record(late > 0 ? late : 0);
+}
+
+static void printRenderJitter(const char* phase) {
+    Serial.printf("Scheduling benchmark (%s): jitter %.1f ms, ", phase,
+                  (renderWakeDelay.get_max_us() - renderWakeDelay.get_avg_us()) / 1000.0f);
+    renderWakeDelay.print();
+}
+
+// Alternate a quiet window with a burst of back-to-back polls (TLS, gzip and
+// JSON on the poll lane) and report the render wake delay for each
+void schedBenchmarkTask(void *parameter) {
+    const unsigned long QUIET_MS = 10000;
+    const uint32_t BURST_POLLS = 20;
+
+    for (;;) {
+        renderWakeDelay.reset();
+        vTaskDelay(pdMS_TO_TICKS(QUIET_MS));
+        printRenderJitter("quiet");
+
+        renderWakeDelay.reset();
+        burstPolls = BURST_POLLS;
+        xTaskNotifyGive(pollTaskHandle);
+        while (burstPolls > 0) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+        }
+        printRenderJitter("API burst");
+    }
+}
+#endif
+
+// Poll lane: low priority, paced by the scheduler and the governor.
+// A poll that has not started yet yields to any pending command.
+void pollTask(void *parameter) {
+    const unsigned long COMMAND_YIELD_MS = 20;
+
+    for (;;) {
+        unsigned long wait = SPOTIFY_UPDATE_INTERVAL;
+
+        if (WiFi.status() == WL_CONNECTED) {
+#ifdef PUSH_EVENTS
+            // Queue-only change: refetch up-next without a playback poll
+            if (pushQueueStale && !commandPending()) {
+                pushQueueStale = false;
+                upNext.clear();
+                prefetchUpNext();
+            }
+#endif
+#ifdef LANE_BENCHMARK
+            // Saturate the poll lane: back-to-back polls, no scheduler or bucket pacing
+            unsigned long pollWait = 0;
+#else
+            unsigned long pollWait = max(pollScheduler.msUntilNextPoll(),
+                                         governor.msUntilAllowed(REQUEST_POLL));
+#endif
+#ifdef SCHED_BENCHMARK
+            if (burstPolls > 0) {
+                pollWait = 0;
+            }
+#endif
+            if (pollWait == 0 && commandPending()) {
+                wait = COMMAND_YIELD_MS;
+            } else if (pollWait == 0) {
+                pollLateness.record(pollScheduler.msOverdue() * 1000UL);
                 updateSpotifyData();
+                wakeRender();
+#ifdef SCHED_BENCHMARK
+                if (burstPolls > 0) {
+                    burstPolls--;
+                }
+#endif
+                wait = 1;
+            } else {
+                wait = pollWait;
+            }
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+    }
+}
+
+#ifdef LANE_BENCHMARK
+// Inject a harmless probe command every few seconds while polling is saturated
+// and report the worst-case press-to-request latency.
+void laneBenchmarkTask(void *parameter) {
+    const unsigned long PROBE_INTERVAL_MS = 2500;
+    const uint32_t PROBES_PER_REPORT = 20;
+
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(PROBE_INTERVAL_MS + random(0, 500)));
+        raiseRequest(CMD_BENCH_PROBE);
+        uint32_t presses = dispatchLatency.get_count();
+        if (presses > 0 && presses % PROBES_PER_REPORT == 0) {
+            Serial.printf("Lane benchmark: worst-case press-to-request %.1f ms over %lu presses\n",
+                          dispatchLatency.get_max_us() / 1000.0f,
+                          (unsigned long)presses);
+        }
+    }
+}
+#endif
+
+#ifdef HEAP_SOAK_TEST
+// Run the poll parse path 100k times over two recorded-style player replies
+// (so the cached Strings keep changing) and check that the largest free heap
+// block stays flat. Runs in setup(), before the network lanes start.
+static const char SOAK_REPLY_A[] =
+    "{\"device\":{\"id\":\"a1\",\"is_active\":true,\"name\":\"Living Room\",\"type\":\"Speaker\",\"volume_percent\":40},"
+    "\"shuffle_state\":false,\"repeat_state\":\"off\",\"context\":{\"type\":\"album\",\"uri\":\"spotify:album:1\","
+    "\"external_urls\":{\"spotify\":\"https://open.spotify.com/album/1\"}},\"progress_ms\":61000,\"is_playing\":true,"
+    "\"item\":{\"album\":{\"id\":\"4aawyAB9vmqN3uQ7FjRGTy\",\"available_markets\":[\"AD\",\"AE\",\"AR\",\"AT\",\"AU\",\"BE\",\"BG\",\"BR\",\"CA\",\"CH\",\"CL\",\"CO\",\"CZ\",\"DE\",\"DK\",\"ES\",\"FI\",\"FR\",\"GB\",\"JP\",\"KR\",\"NL\",\"SG\",\"US\"],"
+    "\"images\":[{\"url\":\"https://i.scdn.co/image/a640\",\"width\":640,\"height\":640},{\"url\":\"https://i.scdn.co/image/a300\",\"width\":300,\"height\":300},"
+    "{\"url\":\"https://i.scdn.co/image/a64\",\"width\":64,\"height\":64}],\"name\":\"Global Warming\"},"
+    "\"artists\":[{\"name\":\"Pitbull\",\"id\":\"0TnOYISbd1XYRBk9myaseg\"}],\"duration_ms\":210000,"
+    "\"id\":\"11dFghVXANMlKmJXsNCbNl\",\"name\":\"Don't Stop the Party\",\"popularity\":61}}";
+static const char SOAK_REPLY_B[] =
+    "{\"device\":{\"id\":\"a1\",\"is_active\":true,\"name\":\"Living Room\",\"type\":\"Speaker\",\"volume_percent\":42},"
+    "\"shuffle_state\":true,\"repeat_state\":\"off\",\"context\":{\"type\":\"playlist\",\"uri\":\"spotify:playlist:2\"},"
+    "\"progress_ms\":1000,\"is_playing\":true,\"item\":{\"album\":{\"id\":\"0sNOF9WDwhWunNAHPD3Baj\","
+    "\"images\":[{\"url\":\"https://i.scdn.co/image/b640\",\"width\":640,\"height\":640},{\"url\":\"https://i.scdn.co/image/b300\",\"width\":300,\"height\":300}],"
+    "\"name\":\"\u5922\u306e\u4e2d\u3078 (Long Edition)\"},\"artists\":[{\"name\":\"\u4e95\u4e0a\u967d\u6c34\"}],\"duration_ms\":1843000,"
+    "\"id\":\"2TpxZ7JUBn3uw46aR7qd6V\",\"name\":\"\u5922\u306e\u4e2d\u3078 - Extended Live Recording at Budokan, Remastered\"}}";
+
+static void soakAssign(String& cached, const char* value) {
+    if (cached != value) {
+        cached = value;
+    }
+}
+
+void heapSoakTest() {
+    const uint32_t CYCLES = 100000;
+    const uint32_t REPORT_EVERY = 10000;
+    const uint32_t ALLOWED_DROP = 1024;
+
+    String artist, track, trackId, album, artUrl;
+    uint32_t firstMaxBlock = 0;
+    uint32_t lastMaxBlock = 0;
+    unsigned long start = millis();
+
+    for (uint32_t i = 1; i <= CYCLES; i++) {
+        pollArena.reset();
+        ApiResponse resp(&pollArena);
+        deserializeJson(resp.reply, (i & 1) ? SOAK_REPLY_A : SOAK_REPLY_B,
+                        DeserializationOption::Filter(playbackFilter));
+        JsonDocument& doc = resp.reply;
+
+        // Same String handling as updateSpotifyData(): assign only on change
+        soakAssign(artist, doc["item"]["artists"][0]["name"] | "");
+        soakAssign(track, doc["item"]["name"] | "");
+        soakAssign(trackId, doc["item"]["id"] | "");
+        soakAssign(album, doc["item"]["album"]["id"] | "");
+        soakAssign(artUrl, doc["item"]["album"]["images"][1]["url"] | "");
+
+        if (i % REPORT_EVERY == 0) {
+            lastMaxBlock = ESP.getMaxAllocHeap();
+            if (firstMaxBlock == 0) {
+                firstMaxBlock = lastMaxBlock;
             }
+            Serial.printf("Heap soak: %lu cycles, largest free block %lu, free %lu\n",
+                          (unsigned long)i, (unsigned long)lastMaxBlock,
+                          (unsigned long)ESP.getFreeHeap());
         }
-        vTaskDelay(SPOTIFY_UPDATE_INTERVAL / portTICK_PERIOD_MS);
+    }
+    Serial.printf("Heap soak %s: largest block %lu -> %lu over %lu cycles (%lu ms)\n",
+                  lastMaxBlock + ALLOWED_DROP >= firstMaxBlock ? "PASS" : "FAIL",
+                  (unsigned long)firstMaxBlock, (unsigned long)lastMaxBlock,
+                  (unsigned long)CYCLES, millis() - start);
+    pollArena.printStats("Poll");
+}
+#endif
+
+#ifdef API_BENCHMARK
+// Time the read-only endpoints over BENCH_ROUNDS calls each and report the
+// heap they cost and the sketch size. Flash the bench-lean and bench-library
+// environments to compare the two backends. Runs before the lanes start.
+void apiBenchmark() {
+    const int BENCH_ROUNDS = 50;
+#ifdef SPOTIFY_API_LIBRARY
+    const char* backend = "SpotifyEsp32 library";
+#else
+    const char* backend = "lean client";
+#endif
+
+    // The lean client's first token arrives from the background refresh
+    unsigned long waitStart = millis();
+    while (pollApi.playbackState(&playbackFilter).status_code == 401 && millis() - waitStart < 15000) {
+        delay(250);
+    }
+
+    LatencyStats playbackTime("Bench playback state");
+    LatencyStats containsTime("Bench tracks/contains");
+    LatencyStats devicesTime("Bench devices");
+    String ids[1] = { "11dFghVXANMlKmJXsNCbNl" };
+    uint32_t heapBefore = ESP.getFreeHeap();
+    uint32_t blockBefore = ESP.getMaxAllocHeap();
+    uint32_t failures = 0;
+
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        unsigned long start = micros();
+        int code = pollApi.playbackState(&playbackFilter).status_code;
+        playbackTime.record(micros() - start);
+        failures += (code < 200 || code >= 300);
+
+        start = micros();
+        code = pollApi.tracksContain(ids, 1).status_code;
+        containsTime.record(micros() - start);
+        failures += (code != 200);
+
+        start = micros();
+        code = pollApi.devices().status_code;
+        devicesTime.record(micros() - start);
+        failures += (code != 200);
+    }
+
+    Serial.printf("API benchmark (%s): sketch %lu bytes, free heap %lu -> %lu (min %lu), largest block %lu -> %lu, %lu failures\n",
+                  backend, (unsigned long)ESP.getSketchSize(),
+                  (unsigned long)heapBefore, (unsigned long)ESP.getFreeHeap(),
+                  (unsigned long)ESP.getMinFreeHeap(), (unsigned long)blockBefore,
+                  (unsigned long)ESP.getMaxAllocHeap(), (unsigned long)failures);
+    playbackTime.print();
+    containsTime.print();
+    devicesTime.print();
+}
+#endif
+
+// Shuffle and liked icons follow the (optimistic) playback model
+void refreshIndicators() {
+    //update the shuffle icon
+    if(playbackModel.get(FIELD_SHUFFLE)){
+        lv_obj_set_flag(ui_shufflegreen, LV_OBJ_FLAG_HIDDEN, false);
+        lv_obj_set_flag(ui_shuffleblack, LV_OBJ_FLAG_HIDDEN, true);
+    }else{
+        lv_obj_set_flag(ui_shufflegreen, LV_OBJ_FLAG_HIDDEN, true);
+        lv_obj_set_flag(ui_shuffleblack, LV_OBJ_FLAG_HIDDEN, false);
+    }
+
+    //visualisation to show if the song is currently liked
+    if(playbackModel.get(FIELD_LIKED)){
+        lv_obj_set_flag(ui_circleplus, LV_OBJ_FLAG_HIDDEN, true);
+        lv_obj_set_flag(ui_circleminus, LV_OBJ_FLAG_HIDDEN, false);
+    }else{
+        lv_obj_set_flag(ui_circleplus, LV_OBJ_FLAG_HIDDEN, false);
+        lv_obj_set_flag(ui_circleminus, LV_OBJ_FLAG_HIDDEN, true);
     }
 }
 
+// Tint whatever was rolled back red for a moment so the user sees it bounce
+void flashRollback(uint8_t fields) {
+    lv_color_t red = lv_color_hex(0xE03030);
+    if (fields & (1 << FIELD_SHUFFLE)) {
+        lv_obj_set_style_image_recolor(ui_shufflegreen, red, 0);
+        lv_obj_set_style_image_recolor_opa(ui_shufflegreen, LV_OPA_70, 0);
+        lv_obj_set_style_image_recolor(ui_shuffleblack, red, 0);
+        lv_obj_set_style_image_recolor_opa(ui_shuffleblack, LV_OPA_70, 0);
+    }
+    if (fields & (1 << FIELD_LIKED)) {
+        lv_obj_set_style_image_recolor(ui_circleplus, red, 0);
+        lv_obj_set_style_image_recolor_opa(ui_circleplus, LV_OPA_70, 0);
+        lv_obj_set_style_image_recolor(ui_circleminus, red, 0);
+        lv_obj_set_style_image_recolor_opa(ui_circleminus, LV_OPA_70, 0);
+    }
+    if (fields & (1 << FIELD_PLAYING)) {
+        lv_obj_set_style_bg_color(ui_Bar1, red, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    }
+    rollbackFlashUntil = millis() + ROLLBACK_FLASH_MS;
+}
+
+void clearRollbackFlash() {
+    lv_obj_set_style_image_recolor_opa(ui_shufflegreen, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_image_recolor_opa(ui_shuffleblack, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_image_recolor_opa(ui_circleplus, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_image_recolor_opa(ui_circleminus, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_bg_color(ui_Bar1, lv_color_hex(0xEDE8E8), LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    rollbackFlashUntil = 0;
+}
+
 //==================== SETUP AND LOOP ========================
+void renderTask(void *parameter);     // defined with the render helpers below
+
 void setup () {
     Serial.begin( 115200 );
     delay(1000);
@@ -565,6 +1226,7 @@ void setup () {
     Serial.println(LVGL_Arduino);
 
     printMemory("Initial");
+    cpuLoad.begin();
 
     data_mutex = xSemaphoreCreateMutex();
     if (data_mutex == NULL) {
@@ -572,14 +1234,18 @@ void setup () {
         while (1) delay(1000);
     }
 
-    // Allocate LVGL buffer
-    buf = (lv_color_t*)malloc(SCREENBUFFER_SIZE_PIXELS * sizeof(lv_color_t));
-    if (buf == nullptr) {
+    if (!commandQueue.begin(COMMAND_QUEUE_DEPTH)) {
+        Serial.println("FATAL: Failed to create command queue!");
+        while (1) delay(1000);
+    }
+
+    // Allocate LVGL buffers
+    if (!displayFlush.allocate()) {
         Serial.println("FATAL: Failed to allocate LVGL buffer!");
         while(1) delay(1000);
     }
-    Serial.printf("✓ LVGL buffer allocated: %d bytes\n",
-                  SCREENBUFFER_SIZE_PIXELS * sizeof(lv_color_t));
+    Serial.printf("✓ LVGL buffers allocated: %d bytes\n",
+                  (int)displayFlush.get_buffer_bytes());
     printMemory("After LVGL buffer");
 
     // WiFi connection
@@ -594,8 +1260,46 @@ void setup () {
 
     // Initialize time and Spotify
     setupTime(); // Assumed function from esp_time.h
-    sp.begin();
+    likedCache.begin();
+    commandSession.setGovernor(&governor);
+    pollSession.setGovernor(&governor);
+    commandSession.setTokenWait(COMMAND_TOKEN_WAIT_MS);
+    tlsSessions.begin(SPOTIFY_API_HOST);
+    commandSession.setSessionCache(&tlsSessions);
+    pollSession.setSessionCache(&tlsSessions);
+    tokens.setSessionCache(&tlsSessions);
+#ifndef SPOTIFY_API_LIBRARY
+    tokens.begin();
+#endif
+#ifdef SPOTIFY_USE_HTTP2
+    if (!http2.begin(&tlsSessions)) {
+        Serial.println("Spotify HTTP/2 connection failed, retrying on the first request");
+    }
+    commandSession.setHttp2(&http2);
+    pollSession.setHttp2(&http2);
+#endif
+    buildFilters();
+    commandSession.setAllocator(&commandArena);
+    pollSession.setAllocator(&pollArena);
+#ifdef HEAP_SOAK_TEST
+    heapSoakTest();
+#endif
+    if (inflater.begin()) {
+        commandSession.setInflater(&inflater);
+        pollSession.setInflater(&inflater);
+        Serial.printf("gzip replies enabled (%u bytes inflate budget)\n", (unsigned)inflater.get_budget());
+    }
+#ifdef SPOTIFY_API_LIBRARY
+    libraryApi.begin();
+#else
+    if (!commandApi.begin() || !pollApi.begin()) {
+        Serial.println("Spotify session setup failed, retrying from the tasks");
+    }
+#endif
     printMemory("After Spotify init");
+#ifdef API_BENCHMARK
+    apiBenchmark();
+#endif
 
     // Initialize LVGL
     lv_init();
@@ -606,8 +1310,11 @@ void setup () {
 
     static lv_disp_t* disp;
     disp = lv_display_create( screenWidth, screenHeight );
-    lv_display_set_buffers( disp, buf, NULL, SCREENBUFFER_SIZE_PIXELS * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_PARTIAL );
-    lv_display_set_flush_cb( disp, my_disp_flush );
+    displayFlush.begin( disp );
+    invalidationPlanner.begin( disp );
+#ifdef FLUSH_BENCHMARK
+    displayFlush.benchmark();
+#endif
 
     static lv_indev_t* indev;
     indev = lv_indev_create();
@@ -621,47 +1328,77 @@ void setup () {
     lv_obj_set_style_text_font(ui_ARTIST_NAME1, &NotoSansCJK_Regular_compressed_v2, 0);
     printMemory("After UI init");
 
+    albumArt.begin();
+    printMemory("After album art init");
+
     // Initial updates
     updateTimeDisplay();
+#ifdef DRAW_BENCHMARK
+    displayFlush.benchmarkRedraw(ui_TIME);     // the clock: the most common partial redraw
+#endif
     
     Serial.println("\n✓ Setup complete!");
 
-    // Start Spotify background task on Core 1
+    // Start the Spotify command and poll lanes next to the Wi-Fi stack
     xTaskCreatePinnedToCore(
-        spotifyTask,
-        "SpotifyTask",
+        commandTask,
+        "CommandTask",
+        12288, // Stack size
+        NULL,  // Parameter
+        COMMAND_PRIORITY,   // above polling
+        &commandTaskHandle,
+        NETWORK_CORE
+    );
+    xTaskCreatePinnedToCore(
+        pollTask,
+        "PollTask",
         16384, // Stack size
         NULL,  // Parameter
-        5,     // Priority
-        &spotifyTaskHandle,
-        1     // Core to pin to
+        POLL_PRIORITY,
+        &pollTaskHandle,
+        NETWORK_CORE
     );
-    Serial.println("✓ Spotify task started on Core 1");
-}
+    Serial.printf("✓ Spotify command and poll lanes started on Core %d\n", (int)NETWORK_CORE);
+
+    // LVGL moves to its own task; from here on loop() only handles input
+    xTaskCreatePinnedToCore(renderTask, "LvglRender", 8192, NULL, RENDER_PRIORITY,
+                            &renderTaskHandle, UI_CORE);
+    albumArt.setOnReady(renderTaskHandle);
+    vTaskPrioritySet(NULL, INPUT_PRIORITY);
+    Serial.printf("✓ LVGL render task started on Core %d\n", (int)UI_CORE);
+
+#ifdef SCHED_BENCHMARK
+    xTaskCreatePinnedToCore(schedBenchmarkTask, "SchedBench", 3072, NULL, 1, NULL, NETWORK_CORE);
+    Serial.println("✓ Scheduling benchmark running");
+#endif
 
-void loop () {
-    // LVGL needs to be called frequently (main loop)
-    lv_timer_handler();
-    vTaskDelay(1);
+#ifdef PUSH_EVENTS
+    pushChannel.begin(handlePushEvent, handlePushLink);
+    Serial.printf("✓ Push events from %s:%u%s\n", PUSH_HOST, (unsigned)PUSH_PORT, PUSH_PATH);
+#endif
 
-    buttonChecks();
-    
-    // Non-blocking LED timeout logic
-    if(ledActive && (millis() - ledStartTime >= LED_HOLD_TIME)) {
-        led.setLow();
-        ledActive = false;
-        //Serial.println("LED turned OFF (1 second hold completed)");
-    }
+#ifdef LANE_BENCHMARK
+    xTaskCreatePinnedToCore(laneBenchmarkTask, "LaneBench", 4096, NULL, 2, NULL, NETWORK_CORE);
+    Serial.println("✓ Lane benchmark running (polling saturated)");
+#endif
+}
 
-    // Thread-safe data handoff from Core 1 to Core 0 (where LVGL runs)
+// Apply what the network lanes, the art task and input changed.
+// Render task only, with the LVGL lock held. True if anything was changed.
+static bool applyUiUpdates() {
+    // Thread-safe data handoff from the poll lane (core 0) to the render task (core 1)
     bool applyArtist = false;
     bool applyTrack = false;
     bool applyDevice = false;
+    bool applyAlbum = false;
     String artistLocal;
     String trackLocal;
     String deviceLocal;
+    String albumLocal;
+    String artUrlLocal;
 
-    if (xSemaphoreTake(data_mutex, (TickType_t)0) == pdTRUE) {
+    // Wait briefly: the render task may not look again for a while
+    if (xSemaphoreTake(data_mutex, pdMS_TO_TICKS(5)) == pdTRUE) {
         if (newArtist) {
             artistLocal = nextArtist;
             newArtist = false;
@@ -680,6 +1417,12 @@ void loop () {
             nextDevice = "";
             applyDevice = true;
         }
+        if (newAlbum) {
+            albumLocal = nextAlbumId;
+            artUrlLocal = nextArtUrl;
+            newAlbum = false;
+            applyAlbum = true;
+        }
 
         xSemaphoreGive(data_mutex);
     }
@@ -701,11 +1444,46 @@ void loop () {
         lv_label_set_text(ui_PLAYING_DEVICE, deviceLocal.c_str()); 
         //Serial.println("Device applied to LVGL: " + deviceLocal);
     }
+    if (applyAlbum) {
+        // Placeholder first: the art task owns the buffer until the new cover is ready
+        lv_image_set_src(ui_Image3, &ui_img_1011443021);
+        albumArt.request(albumLocal, artUrlLocal);
+    }
+    bool changed = applyArtist || applyTrack || applyDevice || applyAlbum;
+    if (albumArt.takeReady()) {
+        lv_image_cache_drop(albumArt.get_image());
+        lv_image_set_src(ui_Image3, albumArt.get_image());
+        changed = true;
+    }
+
+    // Optimistic state and the local volume target are drawn right away, not
+    // on the next tick; volume changes made elsewhere arrive the same way
+    int volume = volumeControl.get();
+    if (volume != displayedVolume) {
+        showVolume(volume);
+        changed = true;
+    }
+    uint32_t modelVersion = playbackModel.get_version();
+    if (modelVersion != shownModelVersion) {
+        shownModelVersion = modelVersion;
+        refreshIndicators();
+        changed = true;
+    }
+    uint8_t rolledBack = playbackModel.takeRollbacks();
+    if (rolledBack) {
+        flashRollback(rolledBack);
+        changed = true;
+    }
+    if (rollbackFlashUntil != 0 && (long)(millis() - rollbackFlashUntil) >= 0) {
+        clearRollbackFlash();
+        changed = true;
+    }
 
     // Time and progress update (every 1 second)
     unsigned long currentMillis = millis();
     if (currentMillis - lastTimeUpdate >= TIME_UPDATE_INTERVAL) {
         lastTimeUpdate = currentMillis;
+        changed = true;
         
         // Update clock display
         updateTimeDisplay();
@@ -724,23 +1502,98 @@ void loop () {
             int progressPercent = (currentProgress * 100) / cachedDuration;
             lv_bar_set_value(ui_Bar1, progressPercent, LV_ANIM_OFF);
         }
+    }
+    return changed;
+}
 
-        //update the shuffle icon
-        if(isShuffle){
-            lv_obj_set_flag(ui_shufflegreen, LV_OBJ_FLAG_HIDDEN, false);
-            lv_obj_set_flag(ui_shuffleblack, LV_OBJ_FLAG_HIDDEN, true);
-        }else{
-            lv_obj_set_flag(ui_shufflegreen, LV_OBJ_FLAG_HIDDEN, true);
-            lv_obj_set_flag(ui_shuffleblack, LV_OBJ_FLAG_HIDDEN, false);
+// Milliseconds until applyUiUpdates() has timed work: the clock tick or the
+// end of a rollback flash
+static uint32_t msUntilUiDeadline() {
+    unsigned long now = millis();
+    unsigned long since = now - lastTimeUpdate;
+    uint32_t wait = since >= TIME_UPDATE_INTERVAL ? 0 : TIME_UPDATE_INTERVAL - since;
+    if (rollbackFlashUntil != 0) {
+        long left = (long)(rollbackFlashUntil - now);
+        if (left <= 0) {
+            wait = 0;
+        } else if ((uint32_t)left < wait) {
+            wait = left;
         }
-        
-        //visualisation to show if the song is currently liked
-        if(isLiked){
-            lv_obj_set_flag(ui_circleplus, LV_OBJ_FLAG_HIDDEN, true);
-            lv_obj_set_flag(ui_circleminus, LV_OBJ_FLAG_HIDDEN, false);
-        }else{
-            lv_obj_set_flag(ui_circleplus, LV_OBJ_FLAG_HIDDEN, false);
-            lv_obj_set_flag(ui_circleminus, LV_OBJ_FLAG_HIDDEN, true);
+    }
+    return wait;
+}
+
+// Frame pacing: full refresh rate while something changes or animates, a
+// slow refresh timer once the screen has been still for a while. A change
+// we apply ourselves makes the refresh run at once, so idle pacing never
+// delays it.
+static void paceRefresh(lv_timer_t* refresh, bool changed) {
+    static uint32_t seenFrames = 0;
+    static unsigned long activeAt = 0;
+    static bool idle = false;
+
+    unsigned long now = millis();
+    uint32_t frames = displayFlush.get_frames();
+    if (changed || frames != seenFrames || lv_anim_count_running() > 0) {
+        seenFrames = frames;
+        activeAt = now;
+    }
+    bool still = now - activeAt >= RENDER_ACTIVE_HOLD_MS;
+    if (still != idle) {
+        idle = still;
+        lv_timer_set_period(refresh, idle ? RENDER_IDLE_REFR_MS : LV_DEF_REFR_PERIOD);
+    }
+    if (changed) {
+        lv_timer_ready(refresh);
+    }
+}
+
+// LVGL render task: after setup, the only task that touches LVGL.
+// Tickless: sleeps until LVGL's next timer or the next clock tick, and is
+// woken early by the lanes, input and the art task.
+void renderTask(void *parameter) {
+    lv_timer_t* refresh = lv_display_get_refr_timer(lv_display_get_default());
+
+    for (;;) {
+        lv_lock();
+        bool changed = applyUiUpdates();
+        paceRefresh(refresh, changed);
+        lv_unlock();
+
+        uint32_t sleepMs = lv_timer_handler();     // takes the LVGL lock itself
+        uint32_t deadline = msUntilUiDeadline();
+        if (deadline < sleepMs) {
+            sleepMs = deadline;
+        }
+        if (sleepMs > RENDER_MAX_SLEEP_MS) {
+            sleepMs = RENDER_MAX_SLEEP_MS;
         }
+#ifdef SCHED_BENCHMARK
+        uint32_t plannedUs = micros() + sleepMs * 1000UL;
+#endif
+        bool notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleepMs)) > 0;
+        renderWakeups++;
+        if (notified) {
+            renderNotified++;
+        }
+#ifdef SCHED_BENCHMARK
+        else {
+            recordWakeDelay(plannedUs);
+        }
+#endif
+    }
+}
+
+// Arduino loop task: input only (buttons, encoder, LED), never LVGL
+void loop () {
+    buttonChecks();
+    
+    // Non-blocking LED timeout logic
+    if(ledActive && (millis() - ledStartTime >= LED_HOLD_TIME)) {
+        led.setLow();
+        ledActive = false;
+        //Serial.println("LED turned OFF (1 second hold completed)");
     }
+    inputWakeups++;
+    vTaskDelay(pdMS_TO_TICKS(INPUT_POLL_MS));
 }
\ No newline at end of file
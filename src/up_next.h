@@ -0,0 +1,166 @@
+#ifndef UP_NEXT_H
+#define UP_NEXT_H
+
+#include <Arduino.h>
+
+// Prefetched metadata for the tracks queued after the current one
+// Filled by the poll lane from /v1/me/player/queue. On Next the UI takes the
+// front entry and shows it straight away; the following poll confirms it.
+// Fixed-size ring storage (names truncated on a UTF-8 boundary) keeps it
+// bounded, and dropping played entries only moves the start index.
+// Cleared when the playback context or shuffle state changes, since the
+// queue order is no longer valid then.
+
+struct UpNextTrack {
+    char id[23];            // Spotify base62 id
+    char name[80];
+    char artist[48];
+    uint32_t durationMs;
+};
+
+class UpNextQueue {
+private:
+    static const size_t CAPACITY = 20;              // /v1/me/player/queue returns up to 20
+    static const unsigned long SKIP_CONFIRM_MS = 3000;
+
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    UpNextTrack tracks[CAPACITY];
+    size_t first = 0;               // ring index of the front entry
+    size_t count = 0;
+    size_t taken = 0;               // entries already shown by optimistic skips
+    unsigned long lastTake = 0;
+
+    // Statistics
+    uint32_t served = 0;            // Next presses answered from the prefetch
+    uint32_t unserved = 0;          // Next presses with nothing prefetched
+    uint32_t confirmed = 0;         // polls that landed on a track we showed
+    uint32_t mispredicted = 0;
+    uint32_t invalidations = 0;
+
+    // Copy at most size-1 bytes without cutting a multi-byte character
+    UpNextTrack& at(size_t i) {
+        return tracks[(first + i) % CAPACITY];
+    }
+
+    static void copyUtf8(char* dst, size_t size, const char* src) {
+        size_t len = src ? strlen(src) : 0;
+        if (len >= size) {
+            len = size - 1;
+            while (len > 0 && ((uint8_t)src[len] & 0xC0) == 0x80) {
+                len--;
+            }
+        }
+        if (len > 0) {
+            memcpy(dst, src, len);
+        }
+        dst[len] = '\0';
+    }
+
+public:
+    // Drop everything (refill or invalidation)
+    void clear() {
+        portENTER_CRITICAL(&lock);
+        if (count > 0) {
+            invalidations++;
+        }
+        count = 0;
+        taken = 0;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Poll lane: append one queue entry; false once full
+    bool add(const char* id, const char* name, const char* artist, uint32_t durationMs) {
+        UpNextTrack track;
+        copyUtf8(track.id, sizeof(track.id), id);
+        copyUtf8(track.name, sizeof(track.name), name);
+        copyUtf8(track.artist, sizeof(track.artist), artist);
+        track.durationMs = durationMs;
+
+        portENTER_CRITICAL(&lock);
+        bool added = count < CAPACITY;
+        if (added) {
+            at(count++) = track;
+        }
+        portEXIT_CRITICAL(&lock);
+        return added;
+    }
+
+    // UI: Next was pressed, hand out the track that should now be playing
+    bool takeNext(UpNextTrack& out) {
+        portENTER_CRITICAL(&lock);
+        bool found = taken < count;
+        if (found) {
+            out = at(taken++);
+            lastTake = millis();
+            served++;
+        } else {
+            unserved++;
+        }
+        portEXIT_CRITICAL(&lock);
+        return found;
+    }
+
+    // Poll lane: the player moved to currentId. Drops everything up to it.
+    // Returns false if it was not in the list (jump elsewhere; list cleared).
+    bool advance(const char* currentId) {
+        portENTER_CRITICAL(&lock);
+        size_t pos = count;
+        for (size_t i = 0; i < count; i++) {
+            if (strcmp(at(i).id, currentId) == 0) {
+                pos = i;
+                break;
+            }
+        }
+        if (taken > 0) {
+            if (pos < taken) {
+                confirmed++;
+            } else {
+                mispredicted++;
+            }
+        }
+        bool found = pos < count;
+        if (found) {
+            size_t drop = pos + 1;
+            first = (first + drop) % CAPACITY;
+            count -= drop;
+            taken = taken > drop ? taken - drop : 0;
+        } else {
+            if (count > 0) {
+                invalidations++;
+            }
+            count = 0;
+            taken = 0;
+        }
+        portEXIT_CRITICAL(&lock);
+        return found;
+    }
+
+    // Entries not yet shown by an optimistic skip
+    size_t remaining() {
+        portENTER_CRITICAL(&lock);
+        size_t result = count - taken;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    // An optimistic skip is on screen but no poll has caught up with it yet.
+    // Gives up after a few seconds so a failed skip does not freeze the display.
+    bool skipsPending() {
+        portENTER_CRITICAL(&lock);
+        if (taken > 0 && millis() - lastTake >= SKIP_CONFIRM_MS) {
+            taken = 0;
+        }
+        bool result = taken > 0;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    void printStats() {
+        Serial.printf("Up next: %u queued, %lu skips served (%lu not prefetched), %lu confirmed, %lu mispredicted, %lu invalidations\n",
+                      (unsigned)count, (unsigned long)served, (unsigned long)unserved,
+                      (unsigned long)confirmed, (unsigned long)mispredicted,
+                      (unsigned long)invalidations);
+    }
+};
+
+#endif
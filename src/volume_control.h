@@ -0,0 +1,142 @@
+#ifndef VOLUME_CONTROL_H
+#define VOLUME_CONTROL_H
+
+#include <Arduino.h>
+
+// Locally cached, coalesced absolute volume
+// Rotary detents move a target volume at once (for the on-screen echo);
+// the Spotify task sends it as a single set_volume after the knob settles.
+// Shared between the UI loop and the Spotify task, guarded by a spinlock.
+
+class VolumeControl {
+private:
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    int volume = -1;             // target/known volume, -1 until first poll
+    int restoreLevel = 20;       // level to return to when unmuting
+    int unknownDelta = 0;        // detents turned before volume was known
+    bool unknownMute = false;    // mute pressed before volume was known
+    bool dirty = false;          // target not yet sent
+    unsigned long lastChange = 0;
+    unsigned long lastSent = 0;
+
+    const int step;
+    const unsigned long settleMs;
+    const unsigned long holdMs;  // ignore polled values this long after sending
+
+public:
+    VolumeControl(int stepPercent = 2, unsigned long settle = 150, unsigned long hold = 1500)
+        : step(stepPercent), settleMs(settle), holdMs(hold) {}
+
+    // Volume reported by a playback poll
+    void onPolled(int polled) {
+        if (polled < 0) {
+            return;
+        }
+        portENTER_CRITICAL(&lock);
+        if (unknownDelta != 0) {
+            volume = constrain(polled + unknownDelta * step, 0, 100);
+            unknownDelta = 0;
+            dirty = true;
+            lastChange = millis();
+        } else if (!dirty && (lastSent == 0 || millis() - lastSent >= holdMs)) {
+            volume = polled;
+        }
+        if (volume > 0) {
+            restoreLevel = volume;
+        }
+        if (unknownMute) {
+            // The early mute press lands now that there is a level to restore
+            unknownMute = false;
+            if (volume > 0) {
+                volume = 0;
+                dirty = true;
+                lastChange = millis() - settleMs;
+            }
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Rotary movement; returns the new target (-1 while still unknown)
+    int adjust(int detents) {
+        portENTER_CRITICAL(&lock);
+        if (volume < 0) {
+            unknownDelta += detents;
+        } else {
+            volume = constrain(volume + detents * step, 0, 100);
+            if (volume > 0) {
+                restoreLevel = volume;
+            }
+            dirty = true;
+            lastChange = millis();
+        }
+        int result = volume;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    // Mute remembers the real level; unmute returns to it. Sent without settling.
+    // Before the first poll the press waits for the base volume (returns -1),
+    // so a mute can never turn an unknown level up to restoreLevel.
+    int toggleMute() {
+        portENTER_CRITICAL(&lock);
+        if (volume < 0) {
+            unknownMute = !unknownMute;
+            portEXIT_CRITICAL(&lock);
+            return -1;
+        }
+        if (volume > 0) {
+            restoreLevel = volume;
+            volume = 0;
+        } else {
+            volume = restoreLevel;
+        }
+        dirty = true;
+        lastChange = millis() - settleMs;
+        int result = volume;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    int get() {
+        portENTER_CRITICAL(&lock);
+        int result = volume;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    // Detents or a mute are waiting for a base volume the poll has not delivered yet
+    bool needsBase() {
+        portENTER_CRITICAL(&lock);
+        bool result = unknownDelta != 0 || unknownMute;
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    // Milliseconds until the target should be sent, or -1 if nothing pending
+    long msUntilDue() {
+        portENTER_CRITICAL(&lock);
+        long result = -1;
+        if (dirty) {
+            unsigned long since = millis() - lastChange;
+            result = since >= settleMs ? 0 : (long)(settleMs - since);
+        }
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+
+    // Claim the settled target for sending; returns -1 if not due yet
+    int takeTarget() {
+        portENTER_CRITICAL(&lock);
+        int result = -1;
+        if (dirty && millis() - lastChange >= settleMs) {
+            dirty = false;
+            lastSent = millis();
+            result = volume;
+        }
+        portEXIT_CRITICAL(&lock);
+        return result;
+    }
+};
+
+#endif
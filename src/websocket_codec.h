@@ -0,0 +1,169 @@
+#ifndef WEBSOCKET_CODEC_H
+#define WEBSOCKET_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// WebSocket framing (RFC 6455) for the push channel, without the socket
+// Plain C++ with no Arduino or FreeRTOS dependency, so the framing and the
+// link rules are unit tested on the host (pio test -e native).
+//  - wsEncodeFrame() builds a masked client frame, any payload length
+//  - wsHeaderSize() / wsParseHeader() decode a frame header read so far
+//  - wsControlReply() answers a ping with a pong and a close with a close
+//  - WsLink decides per frame and per tick: dispatch, ping, or give up
+
+enum WsOpcode : uint8_t {
+    WS_OP_CONTINUATION = 0x0,
+    WS_OP_TEXT = 0x1,
+    WS_OP_BINARY = 0x2,
+    WS_OP_CLOSE = 0x8,
+    WS_OP_PING = 0x9,
+    WS_OP_PONG = 0xA
+};
+
+static const size_t WS_HEADER_MAX = 14;         // 2 + 8 (64-bit length) + 4 (mask)
+static const size_t WS_CONTROL_MAX = 125;       // control frame payload limit
+
+struct WsFrameHeader {
+    bool final;
+    uint8_t opcode;
+    bool masked;
+    uint64_t length;
+    uint8_t key[4];
+};
+
+// Client-to-server frame: FIN set, always masked with `key`.
+// Returns the frame size, or 0 if it does not fit in outSize.
+inline size_t wsEncodeFrame(uint8_t opcode, const uint8_t* payload, size_t len,
+                            const uint8_t key[4], uint8_t* out, size_t outSize) {
+    size_t pos = 0;
+    size_t header = 2 + (len > 0xFFFF ? 8 : (len > 125 ? 2 : 0)) + 4;
+    if (outSize < header || outSize - header < len) {
+        return 0;
+    }
+    out[pos++] = 0x80 | (opcode & 0x0F);
+    if (len > 0xFFFF) {
+        out[pos++] = 0x80 | 127;
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            out[pos++] = (uint8_t)((uint64_t)len >> shift);
+        }
+    } else if (len > 125) {
+        out[pos++] = 0x80 | 126;
+        out[pos++] = (uint8_t)(len >> 8);
+        out[pos++] = (uint8_t)len;
+    } else {
+        out[pos++] = 0x80 | (uint8_t)len;
+    }
+    memcpy(out + pos, key, 4);
+    pos += 4;
+    for (size_t i = 0; i < len; i++) {
+        out[pos + i] = payload[i] ^ key[i & 3];
+    }
+    return pos + len;
+}
+
+// Full header size, known from its first two bytes
+inline size_t wsHeaderSize(const uint8_t head[2]) {
+    uint8_t size = head[1] & 0x7F;
+    return 2 + (size == 127 ? 8 : (size == 126 ? 2 : 0)) + ((head[1] & 0x80) ? 4 : 0);
+}
+
+// Decode a complete header (wsHeaderSize() bytes)
+inline void wsParseHeader(const uint8_t* buf, WsFrameHeader& out) {
+    out.final = buf[0] & 0x80;
+    out.opcode = buf[0] & 0x0F;
+    out.masked = buf[1] & 0x80;
+    out.length = buf[1] & 0x7F;
+    size_t pos = 2;
+    if (out.length >= 126) {
+        int bytes = out.length == 127 ? 8 : 2;
+        out.length = 0;
+        for (int i = 0; i < bytes; i++) {
+            out.length = (out.length << 8) | buf[pos++];
+        }
+    }
+    memset(out.key, 0, sizeof(out.key));
+    if (out.masked) {
+        memcpy(out.key, buf + pos, 4);
+    }
+}
+
+// Unmask (or mask) payload bytes starting at payload offset `offset`
+inline void wsUnmask(uint8_t* data, size_t len, const uint8_t key[4], size_t offset = 0) {
+    for (size_t i = 0; i < len; i++) {
+        data[i] ^= key[(offset + i) & 3];
+    }
+}
+
+// The frame a client must send back for a control frame: a pong with the
+// ping's payload, or a close echoing the status code. 0 for other frames.
+inline size_t wsControlReply(uint8_t opcode, const uint8_t* payload, size_t len,
+                             const uint8_t key[4], uint8_t* out, size_t outSize) {
+    if (opcode == WS_OP_PING) {
+        return wsEncodeFrame(WS_OP_PONG, payload, len > WS_CONTROL_MAX ? WS_CONTROL_MAX : len,
+                             key, out, outSize);
+    }
+    if (opcode == WS_OP_CLOSE) {
+        return wsEncodeFrame(WS_OP_CLOSE, payload, len >= 2 ? 2 : 0, key, out, outSize);
+    }
+    return 0;
+}
+
+// Link rules for one connection, fed with millis() by the caller (32-bit
+// like the ESP32's, so wrap-around is handled the same on the host).
+// Only whole (unfragmented) text messages are dispatched; a fragmented one
+// is skipped up to its final frame. Any received frame counts as life; with
+// nothing received for idleMs the link is given up, and a ping is sent
+// every pingMs so a quiet but healthy server always has something to answer.
+class WsLink {
+private:
+    uint32_t pingMs;
+    uint32_t idleMs;
+    uint32_t lastRx = 0;
+    uint32_t lastPing = 0;
+    bool fragmented = false;
+
+public:
+    enum Action { WS_IGNORE, WS_DISPATCH, WS_CLOSED };
+    enum Tick { WS_WAIT, WS_SEND_PING, WS_IDLE };
+
+    WsLink(uint32_t pingIntervalMs, uint32_t idleTimeoutMs)
+        : pingMs(pingIntervalMs), idleMs(idleTimeoutMs) {}
+
+    void start(uint32_t now) {
+        lastRx = now;
+        lastPing = now;
+        fragmented = false;
+    }
+
+    // A frame arrived; payloadLen is 0 for a payload too big to keep
+    Action onFrame(const WsFrameHeader& header, size_t payloadLen, uint32_t now) {
+        lastRx = now;
+        if (header.opcode == WS_OP_CLOSE) {
+            return WS_CLOSED;
+        }
+        if (header.opcode == WS_OP_TEXT || header.opcode == WS_OP_CONTINUATION) {
+            bool whole = header.opcode == WS_OP_TEXT && header.final && !fragmented;
+            fragmented = !header.final;
+            if (whole && payloadLen > 0) {
+                return WS_DISPATCH;
+            }
+        }
+        return WS_IGNORE;
+    }
+
+    // Nothing to read right now: ping, wait, or give up
+    Tick tick(uint32_t now) {
+        if (now - lastRx >= idleMs) {
+            return WS_IDLE;
+        }
+        if (now - lastPing >= pingMs) {
+            lastPing = now;
+            return WS_SEND_PING;
+        }
+        return WS_WAIT;
+    }
+};
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+// Host stand-in for the parts of the Arduino core and FreeRTOS the src/
+// headers use, so their logic runs under `pio test -e native`.
+// millis() reads a fake clock the tests move forward; spinlocks are no-ops
+// because the tests are single-threaded.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdarg.h>
+#include <algorithm>
+
+using std::max;
+using std::min;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Clock: starts at 1 s so 0 keeps meaning "never" in the code under test
+inline unsigned long nativeMillis = 1000;
+
+inline unsigned long millis() { return nativeMillis; }
+inline unsigned long micros() { return nativeMillis * 1000UL; }
+inline void delay(unsigned long ms) { nativeMillis += ms; }
+inline void advanceMillis(unsigned long ms) { nativeMillis += ms; }
+
+inline long random(long howsmall, long howbig) {
+    return howsmall >= howbig ? howsmall : howsmall + rand() % (howbig - howsmall);
+}
+
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t done = 0;
+        while (done < length) {
+            int c = read();
+            if (c < 0) {
+                break;
+            }
+            buffer[done++] = (char)c;
+        }
+        return done;
+    }
+};
+
+class NativeSerial {
+public:
+    bool quiet = true;      // the tests only look at return values
+
+    int printf(const char* format, ...) {
+        if (quiet) {
+            return 0;
+        }
+        va_list args;
+        va_start(args, format);
+        int n = vprintf(format, args);
+        va_end(args);
+        return n;
+    }
+
+    void println(const char* text) {
+        printf("%s\n", text);
+    }
+};
+
+inline NativeSerial Serial;
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef NATIVE_WIFICLIENT_H
+#define NATIVE_WIFICLIENT_H
+
+#include "Arduino.h"
+
+// Host stand-in for a connected socket: serves a recorded reply from memory,
+// at most one TCP segment per read() like lwIP hands them over. The server
+// keeps the connection open (keep-alive) after the last byte.
+
+class WiFiClient : public Stream {
+private:
+    const uint8_t* data = nullptr;
+    size_t length = 0;
+    size_t pos = 0;
+    size_t segment = 1436;
+
+public:
+    void load(const uint8_t* bytes, size_t size, size_t segmentSize = 1436) {
+        data = bytes;
+        length = size;
+        pos = 0;
+        segment = segmentSize;
+    }
+
+    int available() override {
+        return length - pos;
+    }
+
+    int read() override {
+        return pos < length ? data[pos++] : -1;
+    }
+
+    int read(uint8_t* buffer, size_t size) {
+        size_t n = min(min(size, segment), length - pos);
+        memcpy(buffer, data + pos, n);
+        pos += n;
+        return n;
+    }
+
+    int peek() override {
+        return pos < length ? data[pos] : -1;
+    }
+
+    uint8_t connected() {
+        return 1;
+    }
+
+    size_t write(uint8_t) override { return 1; }
+    void stop() {}
+};
+
+#endif
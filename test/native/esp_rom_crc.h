@@ -0,0 +1,13 @@
+#ifndef NATIVE_ESP_ROM_CRC_H
+#define NATIVE_ESP_ROM_CRC_H
+
+// Host stand-in for the ROM CRC: same standard CRC-32 as zlib's crc32()
+
+#include <stdint.h>
+#include <zlib.h>
+
+inline uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len) {
+    return crc32(crc, buf, len);
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef NATIVE_ROM_MINIZ_H
+#define NATIVE_ROM_MINIZ_H
+
+// Host stand-in for the ROM tinfl inflater, built on the system zlib (-lz)
+// Same calls, flags and statuses as tinfl, including the bit buffer it
+// leaves behind at the end of the deflate stream: tinfl refills 16 bits at
+// a time, so it can pull up to 3 bytes of the gzip trailer into m_bit_buf
+// before it sees the final block end. nativeTinflReadAhead sets how many
+// trailer bytes this stand-in moves into the bit buffer the same way.
+
+#include <stdint.h>
+#include <string.h>
+#include <zlib.h>
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+enum {
+    TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+    TINFL_FLAG_HAS_MORE_INPUT = 2,
+    TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+    TINFL_FLAG_COMPUTE_ADLER32 = 8
+};
+
+typedef enum {
+    TINFL_STATUS_FAILED_CANNOT_MAKE_PROGRESS = -4,
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+typedef uint32_t tinfl_bit_buf_t;       // 32-bit on the ESP32
+
+typedef struct {
+    uint32_t m_num_bits;
+    tinfl_bit_buf_t m_bit_buf;
+    uint32_t magic;
+    bool done;
+    z_stream zs;
+} tinfl_decompressor;
+
+inline size_t nativeTinflReadAhead = 0;
+
+static const uint32_t NATIVE_TINFL_MAGIC = 0x7469666C;
+
+inline void tinfl_init(tinfl_decompressor* r) {
+    if (r->magic == NATIVE_TINFL_MAGIC) {
+        inflateEnd(&r->zs);
+    }
+    memset(r, 0, sizeof(*r));
+    inflateInit2(&r->zs, -MAX_WBITS);       // raw deflate, like tinfl without the zlib flag
+    r->magic = NATIVE_TINFL_MAGIC;
+}
+
+inline tinfl_status tinfl_decompress(tinfl_decompressor* r, const uint8_t* pIn_buf_next, size_t* pIn_buf_size,
+                                     uint8_t* pOut_buf_start, uint8_t* pOut_buf_next, size_t* pOut_buf_size,
+                                     const uint32_t decomp_flags) {
+    (void)pOut_buf_start;
+    if (r->done) {
+        *pIn_buf_size = 0;
+        *pOut_buf_size = 0;
+        return TINFL_STATUS_DONE;
+    }
+    r->zs.next_in = (Bytef*)pIn_buf_next;
+    r->zs.avail_in = *pIn_buf_size;
+    r->zs.next_out = pOut_buf_next;
+    r->zs.avail_out = *pOut_buf_size;
+    int rc = inflate(&r->zs, Z_NO_FLUSH);
+    *pIn_buf_size -= r->zs.avail_in;
+    *pOut_buf_size -= r->zs.avail_out;
+
+    if (rc == Z_STREAM_END) {
+        // Unused bits of the last byte, then whole read-ahead bytes
+        r->m_num_bits = r->zs.data_type & 7;
+        r->m_bit_buf = 0;
+        for (size_t i = 0; i < nativeTinflReadAhead && r->zs.avail_in > 0; i++) {
+            r->m_bit_buf |= (tinfl_bit_buf_t)*r->zs.next_in++ << r->m_num_bits;
+            r->zs.avail_in--;
+            r->m_num_bits += 8;
+            (*pIn_buf_size)++;
+        }
+        r->done = true;
+        return TINFL_STATUS_DONE;
+    }
+    if (rc != Z_OK && rc != Z_BUF_ERROR) {
+        return TINFL_STATUS_FAILED;
+    }
+    if (r->zs.avail_out == 0) {
+        return TINFL_STATUS_HAS_MORE_OUTPUT;
+    }
+    if (!(decomp_flags & TINFL_FLAG_HAS_MORE_INPUT)) {
+        return TINFL_STATUS_FAILED_CANNOT_MAKE_PROGRESS;
+    }
+    return TINFL_STATUS_NEEDS_MORE_INPUT;
+}
+
+#endif
@@ -0,0 +1,805 @@
+#ifndef BENCH_PAYLOADS_H
+#define BENCH_PAYLOADS_H
+
+// /v1/me/player replies in the shape and size the Web API sends them:
+// pretty-printed, with the full available_markets lists. TRACK_PAYLOAD is
+// a track in a playlist (8500 bytes), EPISODE_PAYLOAD a podcast episode with
+// its long show and episode descriptions (11310 bytes).
+
+static const char TRACK_PAYLOAD[] = R"json({
+  "device" : {
+    "id" : "5fbb3ba6aa454b5534c4ba43a8c7e8e45a63ad0e",
+    "is_active" : true,
+    "is_private_session" : false,
+    "is_restricted" : false,
+    "name" : "Living Room",
+    "supports_volume" : true,
+    "type" : "Speaker",
+    "volume_percent" : 42
+  },
+  "shuffle_state" : false,
+  "smart_shuffle" : false,
+  "repeat_state" : "off",
+  "timestamp" : 1728912345678,
+  "context" : {
+    "external_urls" : {
+      "spotify" : "https://open.spotify.com/playlist/37i9dQZF1DXcBWIGoYBM5M"
+    },
+    "href" : "https://api.spotify.com/v1/playlists/37i9dQZF1DXcBWIGoYBM5M",
+    "type" : "playlist",
+    "uri" : "spotify:playlist:37i9dQZF1DXcBWIGoYBM5M"
+  },
+  "progress_ms" : 73512,
+  "item" : {
+    "album" : {
+      "album_type" : "album",
+      "artists" : [
+        {
+          "external_urls" : {
+            "spotify" : "https://open.spotify.com/artist/0TnOYISbd1XYRBk9myaseg"
+          },
+          "href" : "https://api.spotify.com/v1/artists/0TnOYISbd1XYRBk9myaseg",
+          "id" : "0TnOYISbd1XYRBk9myaseg",
+          "name" : "Pitbull",
+          "type" : "artist",
+          "uri" : "spotify:artist:0TnOYISbd1XYRBk9myaseg"
+        }
+      ],
+      "available_markets" : [
+        "AR",
+        "AU",
+        "AT",
+        "BE",
+        "BO",
+        "BR",
+        "BG",
+        "CA",
+        "CL",
+        "CO",
+        "CR",
+        "CY",
+        "CZ",
+        "DK",
+        "DO",
+        "DE",
+        "EC",
+        "EE",
+        "SV",
+        "FI",
+        "FR",
+        "GR",
+        "GT",
+        "HN",
+        "HK",
+        "HU",
+        "IS",
+        "IE",
+        "IT",
+        "LV",
+        "LT",
+        "LU",
+        "MY",
+        "MT",
+        "MX",
+        "NL",
+        "NZ",
+        "NI",
+        "NO",
+        "PA",
+        "PY",
+        "PE",
+        "PH",
+        "PL",
+        "PT",
+        "SG",
+        "SK",
+        "ES",
+        "SE",
+        "CH",
+        "TW",
+        "TR",
+        "UY",
+        "US",
+        "GB",
+        "AD",
+        "LI",
+        "MC",
+        "ID",
+        "JP",
+        "TH",
+        "VN",
+        "RO",
+        "IL",
+        "ZA",
+        "SA",
+        "AE",
+        "BH",
+        "QA",
+        "OM",
+        "KW",
+        "EG",
+        "MA",
+        "DZ",
+        "TN",
+        "LB",
+        "JO",
+        "PS",
+        "IN",
+        "BY",
+        "KZ",
+        "MD",
+        "UA",
+        "AL",
+        "BA",
+        "HR",
+        "ME",
+        "MK",
+        "RS",
+        "SI",
+        "KR",
+        "BD",
+        "PK",
+        "LK",
+        "GH",
+        "KE",
+        "NG",
+        "TZ",
+        "UG",
+        "AG",
+        "AM",
+        "BS",
+        "BB",
+        "BZ",
+        "BT",
+        "BW",
+        "BF",
+        "CV",
+        "CW",
+        "DM",
+        "FJ",
+        "GM",
+        "GE",
+        "GD",
+        "GW",
+        "GY",
+        "HT",
+        "JM",
+        "KI",
+        "LS",
+        "LR",
+        "MW",
+        "MV",
+        "ML",
+        "MH",
+        "FM",
+        "NA",
+        "NR",
+        "NE",
+        "PW",
+        "PG",
+        "PR",
+        "WS",
+        "SM",
+        "ST",
+        "SN",
+        "SC",
+        "SL",
+        "SB",
+        "KN",
+        "LC",
+        "VC",
+        "SR",
+        "TL",
+        "TO",
+        "TT",
+        "TV",
+        "VU",
+        "AZ",
+        "BN",
+        "BI",
+        "KH",
+        "CM",
+        "TD",
+        "KM",
+        "GQ",
+        "SZ",
+        "GA",
+        "GN",
+        "KG",
+        "LA",
+        "MO",
+        "MR",
+        "MN",
+        "NP",
+        "RW",
+        "TG",
+        "UZ",
+        "ZW",
+        "BJ",
+        "MG",
+        "MU",
+        "MZ",
+        "AO",
+        "CI",
+        "DJ",
+        "ZM",
+        "CD",
+        "CG",
+        "IQ",
+        "LY",
+        "TJ",
+        "VE",
+        "ET",
+        "XK"
+      ],
+      "external_urls" : {
+        "spotify" : "https://open.spotify.com/album/4aawyAB9vmqN3uQ7FjRGTy"
+      },
+      "href" : "https://api.spotify.com/v1/albums/4aawyAB9vmqN3uQ7FjRGTy",
+      "id" : "4aawyAB9vmqN3uQ7FjRGTy",
+      "images" : [
+        {
+          "height" : 640,
+          "url" : "https://i.scdn.co/image/ab67616d0000b2734f2d3e1b9a8c7d6e5f4a3b2c",
+          "width" : 640
+        },
+        {
+          "height" : 300,
+          "url" : "https://i.scdn.co/image/ab67616d00001e024f2d3e1b9a8c7d6e5f4a3b2c",
+          "width" : 300
+        },
+        {
+          "height" : 64,
+          "url" : "https://i.scdn.co/image/ab67616d000048514f2d3e1b9a8c7d6e5f4a3b2c",
+          "width" : 64
+        }
+      ],
+      "name" : "Global Warming (Deluxe Version)",
+      "release_date" : "2012-11-16",
+      "release_date_precision" : "day",
+      "total_tracks" : 18,
+      "type" : "album",
+      "uri" : "spotify:album:4aawyAB9vmqN3uQ7FjRGTy"
+    },
+    "artists" : [
+      {
+        "external_urls" : {
+          "spotify" : "https://open.spotify.com/artist/0TnOYISbd1XYRBk9myaseg"
+        },
+        "href" : "https://api.spotify.com/v1/artists/0TnOYISbd1XYRBk9myaseg",
+        "id" : "0TnOYISbd1XYRBk9myaseg",
+        "name" : "Pitbull",
+        "type" : "artist",
+        "uri" : "spotify:artist:0TnOYISbd1XYRBk9myaseg"
+      },
+      {
+        "external_urls" : {
+          "spotify" : "https://open.spotify.com/artist/7bXgB6jMjp9ATFy66eO08Z"
+        },
+        "href" : "https://api.spotify.com/v1/artists/7bXgB6jMjp9ATFy66eO08Z",
+        "id" : "7bXgB6jMjp9ATFy66eO08Z",
+        "name" : "Chris Brown",
+        "type" : "artist",
+        "uri" : "spotify:artist:7bXgB6jMjp9ATFy66eO08Z"
+      }
+    ],
+    "available_markets" : [
+      "AR",
+      "AU",
+      "AT",
+      "BE",
+      "BO",
+      "BR",
+      "BG",
+      "CA",
+      "CL",
+      "CO",
+      "CR",
+      "CY",
+      "CZ",
+      "DK",
+      "DO",
+      "DE",
+      "EC",
+      "EE",
+      "SV",
+      "FI",
+      "FR",
+      "GR",
+      "GT",
+      "HN",
+      "HK",
+      "HU",
+      "IS",
+      "IE",
+      "IT",
+      "LV",
+      "LT",
+      "LU",
+      "MY",
+      "MT",
+      "MX",
+      "NL",
+      "NZ",
+      "NI",
+      "NO",
+      "PA",
+      "PY",
+      "PE",
+      "PH",
+      "PL",
+      "PT",
+      "SG",
+      "SK",
+      "ES",
+      "SE",
+      "CH",
+      "TW",
+      "TR",
+      "UY",
+      "US",
+      "GB",
+      "AD",
+      "LI",
+      "MC",
+      "ID",
+      "JP",
+      "TH",
+      "VN",
+      "RO",
+      "IL",
+      "ZA",
+      "SA",
+      "AE",
+      "BH",
+      "QA",
+      "OM",
+      "KW",
+      "EG",
+      "MA",
+      "DZ",
+      "TN",
+      "LB",
+      "JO",
+      "PS",
+      "IN",
+      "BY",
+      "KZ",
+      "MD",
+      "UA",
+      "AL",
+      "BA",
+      "HR",
+      "ME",
+      "MK",
+      "RS",
+      "SI",
+      "KR",
+      "BD",
+      "PK",
+      "LK",
+      "GH",
+      "KE",
+      "NG",
+      "TZ",
+      "UG",
+      "AG",
+      "AM",
+      "BS",
+      "BB",
+      "BZ",
+      "BT",
+      "BW",
+      "BF",
+      "CV",
+      "CW",
+      "DM",
+      "FJ",
+      "GM",
+      "GE",
+      "GD",
+      "GW",
+      "GY",
+      "HT",
+      "JM",
+      "KI",
+      "LS",
+      "LR",
+      "MW",
+      "MV",
+      "ML",
+      "MH",
+      "FM",
+      "NA",
+      "NR",
+      "NE",
+      "PW",
+      "PG",
+      "PR",
+      "WS",
+      "SM",
+      "ST",
+      "SN",
+      "SC",
+      "SL",
+      "SB",
+      "KN",
+      "LC",
+      "VC",
+      "SR",
+      "TL",
+      "TO",
+      "TT",
+      "TV",
+      "VU",
+      "AZ",
+      "BN",
+      "BI",
+      "KH",
+      "CM",
+      "TD",
+      "KM",
+      "GQ",
+      "SZ",
+      "GA",
+      "GN",
+      "KG",
+      "LA",
+      "MO",
+      "MR",
+      "MN",
+      "NP",
+      "RW",
+      "TG",
+      "UZ",
+      "ZW",
+      "BJ",
+      "MG",
+      "MU",
+      "MZ",
+      "AO",
+      "CI",
+      "DJ",
+      "ZM",
+      "CD",
+      "CG",
+      "IQ",
+      "LY",
+      "TJ",
+      "VE",
+      "ET",
+      "XK"
+    ],
+    "disc_number" : 1,
+    "duration_ms" : 238786,
+    "explicit" : false,
+    "external_ids" : {
+      "isrc" : "USJAY1200120"
+    },
+    "external_urls" : {
+      "spotify" : "https://open.spotify.com/track/6OmhkSOpvYBokMKQxpIGx2"
+    },
+    "href" : "https://api.spotify.com/v1/tracks/6OmhkSOpvYBokMKQxpIGx2",
+    "id" : "6OmhkSOpvYBokMKQxpIGx2",
+    "is_local" : false,
+    "name" : "Don't Stop the Party (feat. TJR)",
+    "popularity" : 71,
+    "preview_url" : null,
+    "track_number" : 2,
+    "type" : "track",
+    "uri" : "spotify:track:6OmhkSOpvYBokMKQxpIGx2"
+  },
+  "currently_playing_type" : "track",
+  "actions" : {
+    "disallows" : {
+      "resuming" : true,
+      "skipping_prev" : false
+    }
+  },
+  "is_playing" : true
+})json";
+
+static const char EPISODE_PAYLOAD[] = R"json({
+  "device" : {
+    "id" : "5fbb3ba6aa454b5534c4ba43a8c7e8e45a63ad0e",
+    "is_active" : true,
+    "is_private_session" : false,
+    "is_restricted" : false,
+    "name" : "Living Room",
+    "supports_volume" : true,
+    "type" : "Speaker",
+    "volume_percent" : 42
+  },
+  "shuffle_state" : false,
+  "smart_shuffle" : false,
+  "repeat_state" : "off",
+  "timestamp" : 1728912345678,
+  "context" : {
+    "external_urls" : {
+      "spotify" : "https://open.spotify.com/show/2mTUnDkuKUkhiueKcVWoP0"
+    },
+    "href" : "https://api.spotify.com/v1/shows/2mTUnDkuKUkhiueKcVWoP0",
+    "type" : "show",
+    "uri" : "spotify:show:2mTUnDkuKUkhiueKcVWoP0"
+  },
+  "progress_ms" : 1203114,
+  "item" : {
+    "audio_preview_url" : "https://podz-content.spotifycdn.com/audio/clips/0Wb7X9kLmN3pQ2rS5tU8vY/clip_132300_192300.mp3",
+    "description" : "In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs: what keep-alive connections buy you, why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM, and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs: what keep-alive connections buy you, why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM, and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs: what keep-alive connections buy you, why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM, and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs: what keep-alive connections buy you, why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM, and how to budget heap so a long uptime does not end in fragmentation. ",
+    "html_description" : "<p>In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs:</p><ul><li>what keep-alive connections buy you</li><li>why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM</li><li>and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs:</p><ul><li>what keep-alive connections buy you</li><li>why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM</li><li>and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs:</p><ul><li>what keep-alive connections buy you</li><li>why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM</li><li>and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs:</p><ul><li>what keep-alive connections buy you</li><li>why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM</li><li>and how to budget heap so a long uptime does not end in fragmentation. </li></ul><p>Links and show notes at <a href=\"https://example.com/notes\">example.com/notes</a>.</p>",
+    "duration_ms" : 3541213,
+    "explicit" : false,
+    "external_urls" : {
+      "spotify" : "https://open.spotify.com/episode/512ojhOuo1ktJprKbVcKyQ"
+    },
+    "href" : "https://api.spotify.com/v1/episodes/512ojhOuo1ktJprKbVcKyQ",
+    "id" : "512ojhOuo1ktJprKbVcKyQ",
+    "images" : [
+      {
+        "height" : 640,
+        "url" : "https://i.scdn.co/image/ab67616d0000b2739e8d7c6b5a4f3e2d1c0b9a8f",
+        "width" : 640
+      },
+      {
+        "height" : 300,
+        "url" : "https://i.scdn.co/image/ab67616d00001e029e8d7c6b5a4f3e2d1c0b9a8f",
+        "width" : 300
+      },
+      {
+        "height" : 64,
+        "url" : "https://i.scdn.co/image/ab67616d000048519e8d7c6b5a4f3e2d1c0b9a8f",
+        "width" : 64
+      }
+    ],
+    "is_externally_hosted" : false,
+    "is_playable" : true,
+    "language" : "en",
+    "languages" : [
+      "en"
+    ],
+    "name" : "Streaming JSON on a microcontroller",
+    "release_date" : "2024-09-30",
+    "release_date_precision" : "day",
+    "resume_point" : {
+      "fully_played" : false,
+      "resume_position_ms" : 0
+    },
+    "show" : {
+      "available_markets" : [
+        "AR",
+        "AU",
+        "AT",
+        "BE",
+        "BO",
+        "BR",
+        "BG",
+        "CA",
+        "CL",
+        "CO",
+        "CR",
+        "CY",
+        "CZ",
+        "DK",
+        "DO",
+        "DE",
+        "EC",
+        "EE",
+        "SV",
+        "FI",
+        "FR",
+        "GR",
+        "GT",
+        "HN",
+        "HK",
+        "HU",
+        "IS",
+        "IE",
+        "IT",
+        "LV",
+        "LT",
+        "LU",
+        "MY",
+        "MT",
+        "MX",
+        "NL",
+        "NZ",
+        "NI",
+        "NO",
+        "PA",
+        "PY",
+        "PE",
+        "PH",
+        "PL",
+        "PT",
+        "SG",
+        "SK",
+        "ES",
+        "SE",
+        "CH",
+        "TW",
+        "TR",
+        "UY",
+        "US",
+        "GB",
+        "AD",
+        "LI",
+        "MC",
+        "ID",
+        "JP",
+        "TH",
+        "VN",
+        "RO",
+        "IL",
+        "ZA",
+        "SA",
+        "AE",
+        "BH",
+        "QA",
+        "OM",
+        "KW",
+        "EG",
+        "MA",
+        "DZ",
+        "TN",
+        "LB",
+        "JO",
+        "PS",
+        "IN",
+        "BY",
+        "KZ",
+        "MD",
+        "UA",
+        "AL",
+        "BA",
+        "HR",
+        "ME",
+        "MK",
+        "RS",
+        "SI",
+        "KR",
+        "BD",
+        "PK",
+        "LK",
+        "GH",
+        "KE",
+        "NG",
+        "TZ",
+        "UG",
+        "AG",
+        "AM",
+        "BS",
+        "BB",
+        "BZ",
+        "BT",
+        "BW",
+        "BF",
+        "CV",
+        "CW",
+        "DM",
+        "FJ",
+        "GM",
+        "GE",
+        "GD",
+        "GW",
+        "GY",
+        "HT",
+        "JM",
+        "KI",
+        "LS",
+        "LR",
+        "MW",
+        "MV",
+        "ML",
+        "MH",
+        "FM",
+        "NA",
+        "NR",
+        "NE",
+        "PW",
+        "PG",
+        "PR",
+        "WS",
+        "SM",
+        "ST",
+        "SN",
+        "SC",
+        "SL",
+        "SB",
+        "KN",
+        "LC",
+        "VC",
+        "SR",
+        "TL",
+        "TO",
+        "TT",
+        "TV",
+        "VU",
+        "AZ",
+        "BN",
+        "BI",
+        "KH",
+        "CM",
+        "TD",
+        "KM",
+        "GQ",
+        "SZ",
+        "GA",
+        "GN",
+        "KG",
+        "LA",
+        "MO",
+        "MR",
+        "MN",
+        "NP",
+        "RW",
+        "TG",
+        "UZ",
+        "ZW",
+        "BJ",
+        "MG",
+        "MU",
+        "MZ",
+        "AO",
+        "CI",
+        "DJ",
+        "ZM",
+        "CD",
+        "CG",
+        "IQ",
+        "LY",
+        "TJ",
+        "VE",
+        "ET",
+        "XK"
+      ],
+      "copyrights" : [],
+      "description" : "In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs: what keep-alive connections buy you, why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM, and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs: what keep-alive connections buy you, why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM, and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs: what keep-alive connections buy you, why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM, and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs: what keep-alive connections buy you, why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM, and how to budget heap so a long uptime does not end in fragmentation. ",
+      "html_description" : "<p>In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs:</p><ul><li>what keep-alive connections buy you</li><li>why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM</li><li>and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs:</p><ul><li>what keep-alive connections buy you</li><li>why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM</li><li>and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs:</p><ul><li>what keep-alive connections buy you</li><li>why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM</li><li>and how to budget heap so a long uptime does not end in fragmentation. In this episode we talk about building small embedded devices that stay responsive while talking to busy web APIs:</p><ul><li>what keep-alive connections buy you</li><li>why streaming parsers matter on microcontrollers with a few hundred kilobytes of RAM</li><li>and how to budget heap so a long uptime does not end in fragmentation. </li></ul><p>Links and show notes at <a href=\"https://example.com/notes\">example.com/notes</a>.</p>",
+      "explicit" : false,
+      "external_urls" : {
+        "spotify" : "https://open.spotify.com/show/2mTUnDkuKUkhiueKcVWoP0"
+      },
+      "href" : "https://api.spotify.com/v1/shows/2mTUnDkuKUkhiueKcVWoP0",
+      "id" : "2mTUnDkuKUkhiueKcVWoP0",
+      "images" : [
+        {
+          "height" : 640,
+          "url" : "https://i.scdn.co/image/ab67616d0000b2739e8d7c6b5a4f3e2d1c0b9a8f",
+          "width" : 640
+        },
+        {
+          "height" : 300,
+          "url" : "https://i.scdn.co/image/ab67616d00001e029e8d7c6b5a4f3e2d1c0b9a8f",
+          "width" : 300
+        },
+        {
+          "height" : 64,
+          "url" : "https://i.scdn.co/image/ab67616d000048519e8d7c6b5a4f3e2d1c0b9a8f",
+          "width" : 64
+        }
+      ],
+      "is_externally_hosted" : false,
+      "languages" : [
+        "en"
+      ],
+      "media_type" : "audio",
+      "name" : "Small Machines",
+      "publisher" : "Small Machines Media",
+      "total_episodes" : 212,
+      "type" : "show",
+      "uri" : "spotify:show:2mTUnDkuKUkhiueKcVWoP0"
+    },
+    "type" : "episode",
+    "uri" : "spotify:episode:512ojhOuo1ktJprKbVcKyQ"
+  },
+  "currently_playing_type" : "episode",
+  "actions" : {
+    "disallows" : {
+      "resuming" : true,
+      "skipping_prev" : false
+    }
+  },
+  "is_playing" : true
+})json";
+
+#endif
@@ -0,0 +1,190 @@
+#include <unity.h>
+#include <ArduinoJson.h>
+#include <chrono>
+#include <string>
+#include "http_body_stream.h"
+#include "payloads.h"
+
+// Streaming vs buffered reply parsing (pio test -e native -f test_body_stream_bench)
+// Each payload is sent chunked, the way api.spotify.com sends it, through
+// two paths:
+//  - streaming: HttpBodyStream undoes the chunking and ArduinoJson parses
+//    (and filters) straight from it, as SpotifyConnection does now
+//  - buffered: the whole body is collected first, growing like the String
+//    HTTPClient::getString() returns, then parsed; this is what the
+//    library's current_playback_state(filter) did before
+// Peak allocation is counted through one allocator for the document, the
+// body buffer and HTTPClient's read buffer. Times are host times: compare
+// the two paths, not the numbers with the ESP32.
+
+static const int ITERATIONS = 200;
+static const size_t TCP_BUFFER_SIZE = 1460;     // HTTPClient's HTTP_TCP_BUFFER_SIZE
+
+static size_t liveBytes = 0;
+static size_t peakBytes = 0;
+
+static void* countedRealloc(void* ptr, size_t size) {
+    size_t* block = ptr ? (size_t*)ptr - 1 : nullptr;
+    if (block) {
+        liveBytes -= *block;
+    }
+    block = (size_t*)realloc(block, size + sizeof(size_t));
+    *block = size;
+    liveBytes += size;
+    peakBytes = max(peakBytes, liveBytes);
+    return block + 1;
+}
+
+static void countedFree(void* ptr) {
+    if (ptr) {
+        size_t* block = (size_t*)ptr - 1;
+        liveBytes -= *block;
+        free(block);
+    }
+}
+
+class CountingAllocator : public ArduinoJson::Allocator {
+public:
+    void* allocate(size_t size) override { return countedRealloc(nullptr, size); }
+    void deallocate(void* ptr) override { countedFree(ptr); }
+    void* reallocate(void* ptr, size_t size) override { return countedRealloc(ptr, size); }
+};
+
+static CountingAllocator allocator;
+static JsonDocument filter;
+
+// Same fields as playbackFilter in ui.cpp
+static void buildFilter() {
+    filter["progress_ms"] = true;
+    filter["is_playing"] = true;
+    filter["item"]["name"] = true;
+    filter["item"]["id"] = true;
+    filter["item"]["duration_ms"] = true;
+    filter["item"]["artists"][0]["name"] = true;
+    filter["item"]["album"]["id"] = true;
+    filter["item"]["album"]["images"][0]["url"] = true;
+    filter["item"]["album"]["images"][0]["width"] = true;
+    filter["device"]["name"] = true;
+    filter["shuffle_state"] = true;
+    filter["device"]["volume_percent"] = true;
+    filter["context"]["uri"] = true;
+    filter["timestamp"] = true;
+}
+
+// Irregular chunk sizes, as the server flushes them
+static std::string chunked(const char* payload) {
+    static const size_t sizes[] = { 1000, 4096, 373, 8192, 2048 };
+    std::string wire;
+    size_t length = strlen(payload);
+    for (size_t pos = 0, i = 0; pos < length; i++) {
+        size_t n = min(sizes[i % 5], length - pos);
+        char header[16];
+        snprintf(header, sizeof(header), "%zx\r\n", n);
+        wire += header;
+        wire.append(payload + pos, n);
+        wire += "\r\n";
+        pos += n;
+    }
+    return wire + "0\r\n\r\n";
+}
+
+struct Result {
+    double usPerParse;
+    size_t peakBytes;
+    std::string json;
+};
+
+static Result parseStreaming(const std::string& wire) {
+    Result result;
+    WiFiClient socket;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        socket.load((const uint8_t*)wire.data(), wire.size());
+        liveBytes = peakBytes = 0;
+
+        JsonDocument doc(&allocator);
+        HttpBodyStream body(&socket, true, -1);
+        DeserializationError err = deserializeJson(doc, body, DeserializationOption::Filter(filter));
+        TEST_ASSERT_FALSE(err);
+        TEST_ASSERT_TRUE(body.drain());
+        if (i == 0) {
+            serializeJson(doc, result.json);
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    result.usPerParse = std::chrono::duration<double, std::micro>(elapsed).count() / ITERATIONS;
+    result.peakBytes = peakBytes;
+    return result;
+}
+
+static Result parseBuffered(const std::string& wire) {
+    Result result;
+    WiFiClient socket;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        socket.load((const uint8_t*)wire.data(), wire.size());
+        liveBytes = peakBytes = 0;
+
+        // getString(): read TCP-buffer sized blocks, append each to the String
+        char* payload = nullptr;
+        size_t length = 0;
+        char* block = (char*)countedRealloc(nullptr, TCP_BUFFER_SIZE);
+        HttpBodyStream body(&socket, true, -1);
+        size_t n;
+        while ((n = body.readBytes(block, TCP_BUFFER_SIZE)) > 0) {
+            payload = (char*)countedRealloc(payload, length + n + 1);
+            memcpy(payload + length, block, n);
+            length += n;
+            payload[length] = '\0';
+        }
+        countedFree(block);
+
+        JsonDocument doc(&allocator);
+        DeserializationError err = deserializeJson(doc, (const char*)payload, length,
+                                                   DeserializationOption::Filter(filter));
+        TEST_ASSERT_FALSE(err);
+        if (i == 0) {
+            serializeJson(doc, result.json);
+        }
+        countedFree(payload);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    result.usPerParse = std::chrono::duration<double, std::micro>(elapsed).count() / ITERATIONS;
+    result.peakBytes = peakBytes;
+    return result;
+}
+
+static void compare(const char* name, const char* payload) {
+    std::string wire = chunked(payload);
+    Result streaming = parseStreaming(wire);
+    Result buffered = parseBuffered(wire);
+
+    char line[200];
+    snprintf(line, sizeof(line), "%s (%zu byte body): streaming %.1f us, peak %zu B | buffered %.1f us, peak %zu B",
+             name, strlen(payload), streaming.usPerParse, streaming.peakBytes,
+             buffered.usPerParse, buffered.peakBytes);
+    TEST_MESSAGE(line);
+
+    // Same document either way; only the buffered path holds the whole body
+    TEST_ASSERT_EQUAL_STRING(buffered.json.c_str(), streaming.json.c_str());
+    TEST_ASSERT_TRUE(buffered.peakBytes >= streaming.peakBytes + strlen(payload));
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_track_payload() {
+    compare("track", TRACK_PAYLOAD);
+}
+
+void test_episode_payload() {
+    compare("episode", EPISODE_PAYLOAD);
+}
+
+int main() {
+    buildFilter();
+    UNITY_BEGIN();
+    RUN_TEST(test_track_payload);
+    RUN_TEST(test_episode_payload);
+    return UNITY_END();
+}
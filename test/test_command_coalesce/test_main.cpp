@@ -0,0 +1,137 @@
+#include <unity.h>
+#include "command_coalesce.h"
+
+// Burst stress tests for the command lane's merge rules (pio test -e native)
+
+static const size_t QUEUE_DEPTH = 16;     // COMMAND_QUEUE_DEPTH in ui.cpp
+
+static size_t fill(Command* cmds, const CommandType* types, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        cmds[i].type = types[i];
+        cmds[i].arg = 0;
+        cmds[i].timestampUs = 1000 + i;
+    }
+    return count;
+}
+
+static size_t countType(const Command* cmds, size_t count, CommandType type) {
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (cmds[i].type == type) {
+            n++;
+        }
+    }
+    return n;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_next_burst_stays_n_skips() {
+    Command cmds[QUEUE_DEPTH];
+    for (size_t n = 1; n <= QUEUE_DEPTH; n++) {
+        CommandType types[QUEUE_DEPTH];
+        for (size_t i = 0; i < n; i++) {
+            types[i] = (i % 3 == 2) ? CMD_PREV : CMD_NEXT;
+        }
+        size_t count = fill(cmds, types, n);
+        uint32_t cancelled = 0;
+        TEST_ASSERT_EQUAL_UINT32(n, coalesceCommands(cmds, count, &cancelled));
+        TEST_ASSERT_EQUAL_UINT32(0, cancelled);
+        for (size_t i = 0; i < n; i++) {
+            TEST_ASSERT_EQUAL(types[i], cmds[i].type);
+        }
+    }
+}
+
+void test_play_pause_run_collapses_to_last_press() {
+    Command cmds[QUEUE_DEPTH];
+    const CommandType odd[] = { CMD_PLAY, CMD_PAUSE, CMD_PLAY, CMD_PAUSE, CMD_PLAY };
+    size_t count = fill(cmds, odd, 5);
+    TEST_ASSERT_EQUAL_UINT32(1, coalesceCommands(cmds, count));
+    TEST_ASSERT_EQUAL(CMD_PLAY, cmds[0].type);
+    TEST_ASSERT_EQUAL_UINT32(1000, cmds[0].timestampUs);    // first press
+
+    const CommandType even[] = { CMD_PAUSE, CMD_PLAY, CMD_PAUSE, CMD_PAUSE };
+    count = fill(cmds, even, 4);
+    TEST_ASSERT_EQUAL_UINT32(1, coalesceCommands(cmds, count));
+    TEST_ASSERT_EQUAL(CMD_PAUSE, cmds[0].type);
+}
+
+void test_play_pause_not_merged_across_a_skip() {
+    Command cmds[QUEUE_DEPTH];
+    const CommandType types[] = { CMD_PAUSE, CMD_NEXT, CMD_PLAY };
+    size_t count = fill(cmds, types, 3);
+    TEST_ASSERT_EQUAL_UINT32(3, coalesceCommands(cmds, count));
+}
+
+void test_toggle_pairs_cancel() {
+    Command cmds[QUEUE_DEPTH];
+    const CommandType pair[] = { CMD_TOGGLE_LIKE, CMD_TOGGLE_LIKE };
+    size_t count = fill(cmds, pair, 2);
+    uint32_t cancelled = 0;
+    TEST_ASSERT_EQUAL_UINT32(0, coalesceCommands(cmds, count, &cancelled));
+    TEST_ASSERT_EQUAL_UINT32(1UL << CMD_TOGGLE_LIKE, cancelled);
+
+    const CommandType triple[] = { CMD_TOGGLE_SHUFFLE, CMD_TOGGLE_SHUFFLE, CMD_TOGGLE_SHUFFLE };
+    count = fill(cmds, triple, 3);
+    TEST_ASSERT_EQUAL_UINT32(1, coalesceCommands(cmds, count, &cancelled));
+    TEST_ASSERT_EQUAL(CMD_TOGGLE_SHUFFLE, cmds[0].type);
+    TEST_ASSERT_EQUAL_UINT32(0, cancelled);     // one toggle is still sent
+}
+
+void test_cancel_exposes_neighbours() {
+    // NEXT, LIKE, LIKE, NEXT: the likes cancel, the skips stay two skips
+    Command cmds[QUEUE_DEPTH];
+    const CommandType types[] = { CMD_NEXT, CMD_TOGGLE_LIKE, CMD_TOGGLE_LIKE, CMD_NEXT };
+    size_t count = fill(cmds, types, 4);
+    uint32_t cancelled = 0;
+    TEST_ASSERT_EQUAL_UINT32(2, coalesceCommands(cmds, count, &cancelled));
+    TEST_ASSERT_EQUAL(CMD_NEXT, cmds[0].type);
+    TEST_ASSERT_EQUAL(CMD_NEXT, cmds[1].type);
+    TEST_ASSERT_EQUAL_UINT32(1UL << CMD_TOGGLE_LIKE, cancelled);
+}
+
+void test_full_queue_burst_accounting() {
+    // A queue-full burst of mashed buttons: merged + sent always adds up to
+    // what was drained, and no skip is lost
+    Command cmds[QUEUE_DEPTH];
+    const CommandType types[QUEUE_DEPTH] = {
+        CMD_PLAY, CMD_PAUSE, CMD_PLAY, CMD_NEXT,
+        CMD_NEXT, CMD_TOGGLE_LIKE, CMD_TOGGLE_LIKE, CMD_TOGGLE_LIKE,
+        CMD_PREV, CMD_TOGGLE_SHUFFLE, CMD_TOGGLE_SHUFFLE, CMD_PAUSE,
+        CMD_PLAY, CMD_PAUSE, CMD_NEXT, CMD_NEXT
+    };
+    size_t count = fill(cmds, types, QUEUE_DEPTH);
+    uint32_t cancelled = 0;
+    size_t sent = coalesceCommands(cmds, count, &cancelled);
+
+    // PLAY, NEXT, NEXT, LIKE, PREV, PAUSE, NEXT, NEXT
+    TEST_ASSERT_EQUAL_UINT32(8, sent);
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_DEPTH - 8, count - sent);   // CommandQueue's "merged"
+    TEST_ASSERT_EQUAL_UINT32(4, countType(cmds, sent, CMD_NEXT));
+    TEST_ASSERT_EQUAL_UINT32(1, countType(cmds, sent, CMD_PREV));
+    TEST_ASSERT_EQUAL_UINT32(1, countType(cmds, sent, CMD_TOGGLE_LIKE));
+    TEST_ASSERT_EQUAL_UINT32(0, countType(cmds, sent, CMD_TOGGLE_SHUFFLE));
+    TEST_ASSERT_EQUAL_UINT32(1UL << CMD_TOGGLE_SHUFFLE, cancelled);
+    TEST_ASSERT_EQUAL(CMD_PAUSE, cmds[5].type);
+}
+
+void test_empty_batch() {
+    Command cmds[1];
+    uint32_t cancelled = 123;
+    TEST_ASSERT_EQUAL_UINT32(0, coalesceCommands(cmds, 0, &cancelled));
+    TEST_ASSERT_EQUAL_UINT32(0, cancelled);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_next_burst_stays_n_skips);
+    RUN_TEST(test_play_pause_run_collapses_to_last_press);
+    RUN_TEST(test_play_pause_not_merged_across_a_skip);
+    RUN_TEST(test_toggle_pairs_cancel);
+    RUN_TEST(test_cancel_exposes_neighbours);
+    RUN_TEST(test_full_queue_burst_accounting);
+    RUN_TEST(test_empty_batch);
+    return UNITY_END();
+}
@@ -0,0 +1,193 @@
+#include <unity.h>
+#include <string>
+#include "gzip_stream.h"
+
+// GzipStream against gzip bodies made by the host zlib (pio test -e native)
+// test/native/rom/miniz.h stands in for the ROM tinfl on top of zlib.
+
+// A reply body as the socket hands it over: a few bytes per read
+class BodyStream : public Stream {
+private:
+    std::string data;
+    size_t pos = 0;
+    size_t perRead;
+
+public:
+    BodyStream(const std::string& bytes, size_t maxPerRead = 97) : data(bytes), perRead(maxPerRead) {}
+
+    int available() override { return data.size() - pos; }
+    int read() override { return pos < data.size() ? (uint8_t)data[pos++] : -1; }
+    int peek() override { return pos < data.size() ? (uint8_t)data[pos] : -1; }
+
+    size_t readBytes(char* buffer, size_t length) override {
+        size_t n = min(min(length, perRead), data.size() - pos);
+        memcpy(buffer, data.data() + pos, n);
+        pos += n;
+        return n;
+    }
+
+    size_t write(uint8_t) override { return 0; }
+};
+
+static GzipInflater inflater;
+
+static std::string gzip(const std::string& text) {
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+    std::string out(deflateBound(&zs, text.size()) + 32, '\0');
+    zs.next_in = (Bytef*)text.data();
+    zs.avail_in = text.size();
+    zs.next_out = (Bytef*)&out[0];
+    zs.avail_out = out.size();
+    TEST_ASSERT_EQUAL_INT(Z_STREAM_END, deflate(&zs, Z_FINISH));
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    return out;
+}
+
+// JSON-like text that does not compress to nothing
+static std::string reply(size_t length) {
+    std::string text = "{\"items\":[";
+    for (unsigned i = 0; text.size() < length; i++) {
+        text += "{\"id\":\"" + std::to_string(i * 2654435761u) + "\",\"n\":" + std::to_string(i) + "},";
+    }
+    text.resize(length);
+    return text;
+}
+
+static std::string inflate(GzipStream& stream, size_t readSize = 61) {
+    std::string out;
+    char buffer[256];
+    size_t n;
+    while ((n = stream.readBytes(buffer, readSize)) > 0) {
+        out.append(buffer, n);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, stream.read());     // stays at the end
+    return out;
+}
+
+void setUp() {
+    nativeTinflReadAhead = 0;
+}
+
+void tearDown() {}
+
+void test_empty_body() {
+    std::string body = gzip("");
+    BodyStream socket(body);
+    GzipStream stream(socket, inflater);
+    TEST_ASSERT_EQUAL_INT(-1, stream.read());
+    TEST_ASSERT_FALSE(stream.has_failed());
+    TEST_ASSERT_EQUAL_UINT32(0, stream.get_bytes_out());
+
+    // No gzip member at all
+    BodyStream nothing("");
+    GzipStream none(nothing, inflater);
+    TEST_ASSERT_EQUAL_INT(-1, none.read());
+    TEST_ASSERT_TRUE(none.has_failed());
+}
+
+void test_body_larger_than_the_window() {
+    std::string text = reply(3 * TINFL_LZ_DICT_SIZE + 1234);
+    std::string body = gzip(text);
+    BodyStream socket(body);
+    GzipStream stream(socket, inflater);
+    std::string out = inflate(stream);
+    TEST_ASSERT_FALSE(stream.has_failed());
+    TEST_ASSERT_EQUAL_UINT32(text.size(), stream.get_bytes_out());
+    TEST_ASSERT_TRUE(out == text);
+}
+
+void test_byte_at_a_time() {
+    std::string text = reply(5000);
+    std::string body = gzip(text);
+    BodyStream socket(body, 1);
+    GzipStream stream(socket, inflater);
+    std::string out;
+    int c;
+    while ((c = stream.read()) >= 0) {
+        out += (char)c;
+    }
+    TEST_ASSERT_FALSE(stream.has_failed());
+    TEST_ASSERT_TRUE(out == text);
+}
+
+void test_truncated_stream() {
+    std::string text = reply(40000);
+    std::string body = gzip(text);
+
+    // Cut inside the deflate data
+    BodyStream cut(body.substr(0, body.size() / 2));
+    GzipStream stream(cut, inflater);
+    std::string out = inflate(stream);
+    TEST_ASSERT_TRUE(stream.has_failed());
+    TEST_ASSERT_TRUE(out.size() < text.size());
+
+    // Cut inside the trailer: all the data, but no length to check it against
+    BodyStream noTrailer(body.substr(0, body.size() - 3));
+    GzipStream short_(noTrailer, inflater);
+    out = inflate(short_);
+    TEST_ASSERT_TRUE(out == text);
+    TEST_ASSERT_TRUE(short_.has_failed());
+}
+
+void test_bad_crc() {
+    std::string text = reply(2000);
+    std::string body = gzip(text);
+    body[body.size() - 8] ^= 0x01;      // first CRC32 byte
+    BodyStream socket(body);
+    GzipStream stream(socket, inflater);
+    std::string out = inflate(stream);
+    TEST_ASSERT_TRUE(out == text);
+    TEST_ASSERT_TRUE(stream.has_failed());
+}
+
+void test_bad_length() {
+    std::string text = reply(2000);
+    std::string body = gzip(text);
+    body[body.size() - 4] ^= 0x01;      // first ISIZE byte
+    BodyStream socket(body);
+    GzipStream stream(socket, inflater);
+    inflate(stream);
+    TEST_ASSERT_TRUE(stream.has_failed());
+}
+
+void test_trailer_read_ahead_into_bit_buffer() {
+    // tinfl may hold 0..3 trailer bytes in its bit buffer when it reports
+    // done; the trailer must still be read in order. Each input split moves
+    // where the read-ahead bytes came from (this read or an earlier one).
+    std::string text = reply(9000);
+    std::string body = gzip(text);
+    for (size_t readAhead = 0; readAhead <= 3; readAhead++) {
+        for (size_t perRead = 1; perRead <= 9; perRead += 4) {
+            nativeTinflReadAhead = readAhead;
+            BodyStream socket(body, perRead);
+            GzipStream stream(socket, inflater);
+            std::string out = inflate(stream);
+            TEST_ASSERT_TRUE(out == text);
+            TEST_ASSERT_FALSE(stream.has_failed());
+        }
+    }
+
+    // A corrupted CRC byte that ends up in the bit buffer is still caught
+    nativeTinflReadAhead = 3;
+    body[body.size() - 7] ^= 0x80;
+    BodyStream socket(body);
+    GzipStream stream(socket, inflater);
+    inflate(stream);
+    TEST_ASSERT_TRUE(stream.has_failed());
+}
+
+int main() {
+    inflater.begin();
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_body);
+    RUN_TEST(test_body_larger_than_the_window);
+    RUN_TEST(test_byte_at_a_time);
+    RUN_TEST(test_truncated_stream);
+    RUN_TEST(test_bad_crc);
+    RUN_TEST(test_bad_length);
+    RUN_TEST(test_trailer_read_ahead_into_bit_buffer);
+    return UNITY_END();
+}
@@ -0,0 +1,120 @@
+#include <unity.h>
+#include "request_governor.h"
+
+// Rate-limit, back-off and breaker rules against the fake clock in
+// test/native/Arduino.h (pio test -e native)
+
+void setUp() {}
+void tearDown() {}
+
+void test_429_honours_retry_after() {
+    RequestGovernor governor;
+    governor.onResult(429, 7);
+    TEST_ASSERT_EQUAL_UINT32(7000, governor.msUntilAllowed(REQUEST_COMMAND));
+    TEST_ASSERT_EQUAL_UINT32(7000, governor.msUntilAllowed(REQUEST_POLL));
+
+    advanceMillis(6999);
+    TEST_ASSERT_EQUAL_UINT32(1, governor.msUntilAllowed(REQUEST_COMMAND));
+    advanceMillis(1);
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_COMMAND));
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_POLL));
+}
+
+void test_429_without_retry_after_waits_5s() {
+    RequestGovernor governor;
+    governor.onResult(429, -1);
+    TEST_ASSERT_EQUAL_UINT32(5000, governor.msUntilAllowed(REQUEST_COMMAND));
+    advanceMillis(5000);
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_COMMAND));
+}
+
+void test_server_error_backs_off_polls_only() {
+    RequestGovernor governor;
+    governor.onResult(503, -1);
+    unsigned long wait = governor.msUntilAllowed(REQUEST_POLL);
+    TEST_ASSERT_UINT32_WITHIN(250, 1250, wait);      // 1 s plus up to 50% jitter
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_COMMAND));
+
+    // The second failure doubles the base
+    advanceMillis(wait);
+    governor.onResult(500, -1);
+    TEST_ASSERT_UINT32_WITHIN(500, 2500, governor.msUntilAllowed(REQUEST_POLL));
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_COMMAND));
+
+    // Any answer clears the back-off
+    governor.onResult(200, -1);
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_POLL));
+}
+
+void test_transport_error_backs_off_polls_only() {
+    RequestGovernor governor;
+    governor.onResult(-1, -1);
+    TEST_ASSERT_UINT32_WITHIN(250, 1250, governor.msUntilAllowed(REQUEST_POLL));
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_COMMAND));
+}
+
+void test_breaker_opens_after_5_failures_and_closes_after_30s() {
+    RequestGovernor governor;
+    for (int i = 0; i < 4; i++) {
+        governor.onResult(502, -1);
+        TEST_ASSERT_FALSE(governor.is_breaker_open());
+    }
+    governor.onResult(502, -1);
+    TEST_ASSERT_TRUE(governor.is_breaker_open());
+    // 16 s back-off plus jitter stays under the 30 s the breaker holds polls
+    TEST_ASSERT_EQUAL_UINT32(30000, governor.msUntilAllowed(REQUEST_POLL));
+
+    advanceMillis(29999);
+    TEST_ASSERT_TRUE(governor.is_breaker_open());
+    advanceMillis(1);
+    TEST_ASSERT_FALSE(governor.is_breaker_open());
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_POLL));
+
+    // The probe poll fails: open again straight away, with a longer back-off
+    governor.onResult(-1, -1);
+    TEST_ASSERT_TRUE(governor.is_breaker_open());
+    TEST_ASSERT_TRUE(governor.msUntilAllowed(REQUEST_POLL) >= 30000);
+}
+
+void test_commands_pass_while_polls_are_blocked() {
+    RequestGovernor governor;
+    for (int i = 0; i < 5; i++) {
+        governor.onResult(-1, -1);
+    }
+    TEST_ASSERT_TRUE(governor.msUntilAllowed(REQUEST_POLL) > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_COMMAND));
+
+    // A command that gets an answer closes the breaker for the polls too
+    governor.onSend();
+    governor.onResult(204, -1);
+    TEST_ASSERT_FALSE(governor.is_breaker_open());
+    TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_POLL));
+}
+
+void test_polls_leave_tokens_for_commands() {
+    RequestGovernor governor;
+    governor.msUntilAllowed(REQUEST_POLL);      // starts the refill clock
+    for (int i = 0; i < 7; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_POLL));
+        governor.onSend();
+    }
+    // Three tokens left: reserved for commands
+    TEST_ASSERT_TRUE(governor.msUntilAllowed(REQUEST_POLL) > 0);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, governor.msUntilAllowed(REQUEST_COMMAND));
+        governor.onSend();
+    }
+    TEST_ASSERT_EQUAL_UINT32(1001, governor.msUntilAllowed(REQUEST_COMMAND));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_429_honours_retry_after);
+    RUN_TEST(test_429_without_retry_after_waits_5s);
+    RUN_TEST(test_server_error_backs_off_polls_only);
+    RUN_TEST(test_transport_error_backs_off_polls_only);
+    RUN_TEST(test_breaker_opens_after_5_failures_and_closes_after_30s);
+    RUN_TEST(test_commands_pass_while_polls_are_blocked);
+    RUN_TEST(test_polls_leave_tokens_for_commands);
+    return UNITY_END();
+}
@@ -0,0 +1,185 @@
+#include <unity.h>
+#include <vector>
+#include "websocket_codec.h"
+
+// WebSocket framing and link rules of the push channel (pio test -e native)
+// Byte sequences marked RFC are the examples in RFC 6455 section 5.7.
+
+static const uint8_t RFC_KEY[4] = { 0x37, 0xFA, 0x21, 0x3D };
+
+static WsFrameHeader parse(const uint8_t* frame) {
+    WsFrameHeader header;
+    wsParseHeader(frame, header);
+    return header;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_client_frames_are_masked() {
+    // RFC: a single-frame masked text message containing "Hello"
+    const uint8_t expected[] = { 0x81, 0x85, 0x37, 0xFA, 0x21, 0x3D, 0x7F, 0x9F, 0x4D, 0x51, 0x58 };
+    uint8_t out[32];
+    size_t n = wsEncodeFrame(WS_OP_TEXT, (const uint8_t*)"Hello", 5, RFC_KEY, out, sizeof(out));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(expected), n);
+    TEST_ASSERT_EQUAL_MEMORY(expected, out, n);
+
+    // And it decodes back
+    WsFrameHeader header = parse(out);
+    TEST_ASSERT_EQUAL_UINT32(6, wsHeaderSize(out));
+    TEST_ASSERT_TRUE(header.final);
+    TEST_ASSERT_TRUE(header.masked);
+    TEST_ASSERT_EQUAL_UINT32(5, header.length);
+    wsUnmask(out + 6, 5, header.key);
+    TEST_ASSERT_EQUAL_MEMORY("Hello", out + 6, 5);
+}
+
+void test_unmasked_server_frame() {
+    // RFC: a single-frame unmasked text message containing "Hello"
+    const uint8_t frame[] = { 0x81, 0x05, 0x48, 0x65, 0x6C, 0x6C, 0x6F };
+    TEST_ASSERT_EQUAL_UINT32(2, wsHeaderSize(frame));
+    WsFrameHeader header = parse(frame);
+    TEST_ASSERT_EQUAL_UINT32(WS_OP_TEXT, header.opcode);
+    TEST_ASSERT_FALSE(header.masked);
+    TEST_ASSERT_EQUAL_UINT32(5, header.length);
+}
+
+void test_16_bit_length() {
+    std::vector<uint8_t> payload(256, 'x');
+    std::vector<uint8_t> out(WS_HEADER_MAX + payload.size());
+    size_t n = wsEncodeFrame(WS_OP_BINARY, payload.data(), payload.size(), RFC_KEY, out.data(), out.size());
+    TEST_ASSERT_EQUAL_UINT32(8 + 256, n);
+    TEST_ASSERT_EQUAL_UINT32(0x80 | 126, out[1]);
+    TEST_ASSERT_EQUAL_UINT32(0x01, out[2]);
+    TEST_ASSERT_EQUAL_UINT32(0x00, out[3]);
+    TEST_ASSERT_EQUAL_UINT32(8, wsHeaderSize(out.data()));
+    TEST_ASSERT_EQUAL_UINT32(256, parse(out.data()).length);
+
+    // 125 still fits the short form, 126 does not
+    TEST_ASSERT_EQUAL_UINT32(6 + 125, wsEncodeFrame(WS_OP_TEXT, payload.data(), 125, RFC_KEY, out.data(), out.size()));
+    TEST_ASSERT_EQUAL_UINT32(8 + 126, wsEncodeFrame(WS_OP_TEXT, payload.data(), 126, RFC_KEY, out.data(), out.size()));
+
+    // RFC: 256 bytes binary message in a single unmasked frame
+    const uint8_t server[] = { 0x82, 0x7E, 0x01, 0x00 };
+    TEST_ASSERT_EQUAL_UINT32(4, wsHeaderSize(server));
+    TEST_ASSERT_EQUAL_UINT32(256, parse(server).length);
+}
+
+void test_64_bit_length() {
+    std::vector<uint8_t> payload(70000, 'y');
+    std::vector<uint8_t> out(WS_HEADER_MAX + payload.size());
+    size_t n = wsEncodeFrame(WS_OP_BINARY, payload.data(), payload.size(), RFC_KEY, out.data(), out.size());
+    TEST_ASSERT_EQUAL_UINT32(14 + 70000, n);
+    TEST_ASSERT_EQUAL_UINT32(0x80 | 127, out[1]);
+    TEST_ASSERT_EQUAL_UINT32(14, wsHeaderSize(out.data()));
+    TEST_ASSERT_EQUAL_UINT32(70000, parse(out.data()).length);
+
+    // RFC: 64KiB binary message in a single unmasked frame
+    const uint8_t server[] = { 0x82, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00 };
+    TEST_ASSERT_EQUAL_UINT32(10, wsHeaderSize(server));
+    TEST_ASSERT_EQUAL_UINT32(65536, parse(server).length);
+
+    // Too small an output buffer is refused, not overrun
+    TEST_ASSERT_EQUAL_UINT32(0, wsEncodeFrame(WS_OP_BINARY, payload.data(), payload.size(),
+                                              RFC_KEY, out.data(), out.size() - 1));
+}
+
+void test_ping_gets_pong() {
+    // RFC: unmasked ping request with a body of "Hello"
+    uint8_t ping[] = { 0x89, 0x05, 0x48, 0x65, 0x6C, 0x6C, 0x6F };
+    WsFrameHeader header = parse(ping);
+    TEST_ASSERT_EQUAL_UINT32(WS_OP_PING, header.opcode);
+
+    // RFC: masked pong response with a body of "Hello", i.e. our reply
+    const uint8_t pong[] = { 0x8A, 0x85, 0x37, 0xFA, 0x21, 0x3D, 0x7F, 0x9F, 0x4D, 0x51, 0x58 };
+    uint8_t out[WS_HEADER_MAX + WS_CONTROL_MAX];
+    size_t n = wsControlReply(header.opcode, ping + 2, header.length, RFC_KEY, out, sizeof(out));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(pong), n);
+    TEST_ASSERT_EQUAL_MEMORY(pong, out, n);
+
+    // A ping does not end the link and is not an event
+    WsLink link(20000, 45000);
+    link.start(0);
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_IGNORE, link.onFrame(header, header.length, 10));
+
+    // Data frames need no reply
+    uint8_t text[] = { 0x81, 0x02, 0x7B, 0x7D };
+    TEST_ASSERT_EQUAL_UINT32(0, wsControlReply(WS_OP_TEXT, text + 2, 2, RFC_KEY, out, sizeof(out)));
+}
+
+void test_close_is_echoed_and_ends_the_link() {
+    // Server close with status 1001 (going away) and a reason
+    const uint8_t close[] = { 0x88, 0x06, 0x03, 0xE9, 'b', 'y', 'e', '!' };
+    WsFrameHeader header = parse(close);
+    uint8_t out[WS_HEADER_MAX + WS_CONTROL_MAX];
+    size_t n = wsControlReply(header.opcode, close + 2, header.length, RFC_KEY, out, sizeof(out));
+
+    // Our close echoes the status code only, masked
+    TEST_ASSERT_EQUAL_UINT32(6 + 2, n);
+    WsFrameHeader reply = parse(out);
+    TEST_ASSERT_EQUAL_UINT32(WS_OP_CLOSE, reply.opcode);
+    TEST_ASSERT_TRUE(reply.masked);
+    TEST_ASSERT_EQUAL_UINT32(2, reply.length);
+    wsUnmask(out + 6, 2, reply.key);
+    TEST_ASSERT_EQUAL_MEMORY(close + 2, out + 6, 2);
+
+    WsLink link(20000, 45000);
+    link.start(0);
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_CLOSED, link.onFrame(header, header.length, 10));
+
+    // A close without a status gets an empty close back
+    const uint8_t bare[] = { 0x88, 0x00 };
+    TEST_ASSERT_EQUAL_UINT32(6, wsControlReply(WS_OP_CLOSE, bare + 2, 0, RFC_KEY, out, sizeof(out)));
+}
+
+void test_only_whole_text_messages_dispatch() {
+    WsLink link(20000, 45000);
+    link.start(0);
+    // RFC: a fragmented unmasked text message, "Hel" then "lo"
+    const uint8_t first[] = { 0x01, 0x03, 0x48, 0x65, 0x6C };
+    const uint8_t last[] = { 0x80, 0x02, 0x6C, 0x6F };
+    const uint8_t whole[] = { 0x81, 0x02, 0x7B, 0x7D };
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_IGNORE, link.onFrame(parse(first), 3, 1));
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_IGNORE, link.onFrame(parse(last), 2, 2));
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_DISPATCH, link.onFrame(parse(whole), 2, 3));
+    // A payload too big to keep (reported as 0 bytes) is skipped
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_IGNORE, link.onFrame(parse(whole), 0, 4));
+}
+
+void test_idle_timeout_and_pings() {
+    WsLink link(20000, 45000);
+    link.start(1000);
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_WAIT, link.tick(1000 + 19999));
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_SEND_PING, link.tick(1000 + 20000));
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_WAIT, link.tick(1000 + 20050));
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_SEND_PING, link.tick(1000 + 40000));
+    // No pong to either ping: given up 45 s after the last frame
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_WAIT, link.tick(1000 + 44999));
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_IDLE, link.tick(1000 + 45000));
+
+    // Any frame, a pong included, keeps the link alive
+    link.start(1000);
+    const uint8_t pong[] = { 0x8A, 0x00 };
+    link.onFrame(parse(pong), 0, 1000 + 30000);
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_SEND_PING, link.tick(1000 + 45000));
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_WAIT, link.tick(1000 + 64999));
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_SEND_PING, link.tick(1000 + 74999));
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_IDLE, link.tick(1000 + 75000));
+
+    // millis() wrapping around does not look like a timeout
+    link.start(0xFFFFF000UL);
+    TEST_ASSERT_EQUAL_UINT32(WsLink::WS_WAIT, link.tick(0x00000100UL));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_client_frames_are_masked);
+    RUN_TEST(test_unmasked_server_frame);
+    RUN_TEST(test_16_bit_length);
+    RUN_TEST(test_64_bit_length);
+    RUN_TEST(test_ping_gets_pong);
+    RUN_TEST(test_close_is_echoed_and_ends_the_link);
+    RUN_TEST(test_only_whole_text_messages_dispatch);
+    RUN_TEST(test_idle_timeout_and_pings);
+    return UNITY_END();
+}